@@ -12,6 +12,8 @@ MGS_DATCK	:= 0x6028
 ; Hopstepz sub-routines
 ST16MS		:= 0x0039
 WT16MS		:= 0x003A
+SETMGSWK	:= 0x003B
+GETLOOPCT	:= 0x003C
 
 	org	0x100
 
@@ -22,6 +24,7 @@ begin:
 	out		[0xfd], a
 
 	call	MGS_SYSCK
+	call	SETMGSWK		; IX=MGSDRVのワークエリアをHopstepzへ教える
 	call	MGS_INITM
 
 volume_max:
@@ -31,7 +34,7 @@ volume_max:
 
 start_play:
 	ld		de, 0x8000
-	ld		b, 0xff
+	call	GETLOOPCT		; B=ループ回数(0xFF=無限)をHopstepzからもらう
 	ld		hl, 0xffff
 	call	MGS_PLYST
 	ei
@@ -0,0 +1,233 @@
+﻿#include "stdafx.h"
+#include "CChipPipeline.h"
+#include "RmmChipMuse.h"
+#include "CRealtime.h"
+#include <chrono>
+
+static const int QUEUE_POLL_US = 200;		// 出力スレッドがキューの空きを見に行く間隔
+static const int LOOKAHEAD_POLL_US = 1000;	// 演奏スレッドが先読みの空きを見に行く間隔
+
+/**
+ * @param periodNs 出力スレッドがチップに書き込む周期（1フレームの時間）
+ */
+CChipPipeline::CChipPipeline(const int64_t periodNs) :
+	m_Produced(0), m_Consumed(0), m_bQuit(false), m_bResetTiming(false),
+	m_bOverloaded(false), m_Skipped(0), m_Sched(periodNs)
+{
+	m_bPipelined = false;
+	m_Lookahead = 0;
+	m_bPending = false;
+	m_Priority = 0;
+	m_Cpu = -1;
+	m_pProfiler = nullptr;
+	return;
+}
+
+CChipPipeline::~CChipPipeline()
+{
+	Stop();
+	return;
+}
+
+/** 先読みしない場合に、チップへの書き込み時間を記録する先
+ */
+void CChipPipeline::SetProfiler(CFrameProfiler *pProfiler)
+{
+	m_pProfiler = pProfiler;
+	return;
+}
+
+/** 出力スレッドを起動して、先読みを始める
+ * @param lookahead 演奏スレッドが先に実行してよいフレーム数（0 なら先読みしない）
+ * @param priority 出力スレッドの SCHED_FIFO の優先度（0 なら変えない）
+ * @param cpu 出力スレッドを固定するコアの番号（負の値なら固定しない）
+ */
+void CChipPipeline::Start(const int lookahead, const int priority, const int cpu)
+{
+	Stop();
+	if( lookahead <= 0 )
+		return;
+	m_Lookahead = (MAX_LOOKAHEAD < lookahead) ? MAX_LOOKAHEAD : lookahead;
+	m_Priority = priority;
+	m_Cpu = cpu;
+	m_Produced = 0;
+	m_Consumed = 0;
+	m_bPending = false;
+	m_bQuit = false;
+	m_bResetTiming = true;
+	m_bPipelined = true;
+	m_Thread = std::thread(&CChipPipeline::outputThread, this);
+	return;
+}
+
+/** 積んである書き込みをすべて出力し終えてから、出力スレッドを止める
+ */
+void CChipPipeline::Stop()
+{
+	if( !m_bPipelined )
+		return;
+	Flush();
+	m_bQuit = true;
+	if( m_Thread.joinable() )
+		m_Thread.join();
+	m_bPipelined = false;
+	return;
+}
+
+bool CChipPipeline::IsPipelined() const
+{
+	return m_bPipelined;
+}
+
+/** 演奏スレッドが WT16MS で呼び、1フレーム分の書き込みを区切る
+ * 先読みしているフレーム数が上限に達していたら、出力スレッドが追いつくまで待つ。
+ */
+void CChipPipeline::EndFrame()
+{
+	CHIPWRITE w;
+	memset(&w, 0, sizeof(w));
+	w.Op = OP_FRAME;
+	push(w);
+	m_bPending = false;
+	const uint32_t produced = m_Produced.fetch_add(1) + 1;
+	while( m_Lookahead <= static_cast<int>(produced - m_Consumed.load()) && !m_bQuit )
+		std::this_thread::sleep_for(std::chrono::microseconds(LOOKAHEAD_POLL_US));
+	return;
+}
+
+/** 積んである書き込みをすべて実チップに書き込み終えるまで待つ（消音や一時停止をすぐに反映させるため）
+ */
+void CChipPipeline::Flush()
+{
+	if( !m_bPipelined )
+		return;
+	if( m_bPending ){
+		CHIPWRITE w;
+		memset(&w, 0, sizeof(w));
+		w.Op = OP_FRAME;
+		push(w);
+		m_bPending = false;
+		m_Produced.fetch_add(1);
+	}
+	while( m_Consumed.load() != m_Produced.load() && !m_bQuit )
+		std::this_thread::sleep_for(std::chrono::microseconds(LOOKAHEAD_POLL_US));
+	return;
+}
+
+/** 次に出力するフレームから、期限の基点を置き直す（曲の開始、シーク、一時停止からの再開など）
+ */
+void CChipPipeline::ResetTiming()
+{
+	m_bResetTiming = true;
+	return;
+}
+
+/** 出力スレッドのフレームの周期を変える（次のフレームから）
+ */
+void CChipPipeline::SetFramePeriod(const int64_t periodNs)
+{
+	m_Sched.SetPeriod(periodNs);
+	return;
+}
+
+/** 出力スレッドの待ち合わせの統計（Stop() の後で読むこと）
+ */
+const CFrameScheduler::STATS &CChipPipeline::GetStats() const
+{
+	return m_Sched.GetStats();
+}
+
+/** 出力スレッドの待ち合わせでのテンポの正確さ[%]（演奏中に読んでもよい）
+ */
+double CChipPipeline::GetTempoAccuracy() const
+{
+	return m_Sched.GetTempoAccuracy();
+}
+
+/** 先読みしない場合に、演奏スレッドの待ち合わせで過負荷かどうかを知らせる
+ */
+void CChipPipeline::SetOverloaded(const bool bOverloaded)
+{
+	m_bOverloaded.store(bOverloaded, std::memory_order_relaxed);
+	return;
+}
+
+/** 過負荷のために省いた書き込みの数
+ */
+uint64_t CChipPipeline::GetSkippedWrites() const
+{
+	return m_Skipped.load(std::memory_order_relaxed);
+}
+
+void CChipPipeline::PrintProfile() const
+{
+	m_OutProfiler.Print(_T("output[us]"));
+	return;
+}
+
+/** 実チップに書き込む
+ */
+void CChipPipeline::WriteChip(const CHIPWRITE &w)
+{
+	switch(w.Op)
+	{
+		case OP_REG:	w.pChip->SetRegister(w.Addr, w.Data);	break;
+		case OP_ADDR:	w.pChip->SetRegisterAddr(w.Addr);		break;
+		case OP_DATA:	w.pChip->SetRegisterData(w.Data);		break;
+		default:												break;
+	}
+	return;
+}
+
+/** キューが満杯なら、出力スレッドが空けるまで待つ
+ */
+void CChipPipeline::push(const CHIPWRITE &w)
+{
+	while( !m_Queue.Push(w) && !m_bQuit )
+		std::this_thread::sleep_for(std::chrono::microseconds(QUEUE_POLL_US));
+	return;
+}
+
+/** フレームの区切りごとに期限まで待ってから、次のフレームの書き込みをまとめて実チップへ書き込む
+ */
+void CChipPipeline::outputThread()
+{
+	if( 0 < m_Priority ){
+		std::string reason;
+		if( 0 <= m_Cpu && !CRealtime::SetThreadAffinity(m_Cpu, &reason) )
+			::wprintf(_T("REALTIME(output): %hs, not pinned\n"), reason.c_str());
+		// 出力スレッドの方が期限に厳しいので、演奏スレッドより１つ上げる
+		const int prio = (m_Priority < 99) ? m_Priority + 1 : m_Priority;
+		if( !CRealtime::SetThreadPriority(prio, &reason) )
+			::wprintf(_T("REALTIME(output): %hs, using normal scheduling\n"), reason.c_str());
+	}
+	bool bInFrame = false;
+	for(;;){
+		CHIPWRITE w;
+		if( !m_Queue.Pop(&w) ){
+			if( m_bQuit )
+				break;
+			std::this_thread::sleep_for(std::chrono::microseconds(QUEUE_POLL_US));
+			continue;
+		}
+		if( !bInFrame ){
+			if( m_bResetTiming.exchange(false) )
+				m_Sched.Stop();
+			m_OutProfiler.BeginWait();
+			const int64_t requested = m_Sched.WaitNextFrame();
+			m_OutProfiler.EndWait(requested);
+			m_bOverloaded.store(m_Sched.IsOverloaded(), std::memory_order_relaxed);
+			bInFrame = true;
+		}
+		if( w.Op == OP_FRAME ){
+			m_OutProfiler.RecordChips();
+			m_Consumed.fetch_add(1);
+			bInFrame = false;
+			continue;
+		}
+		const uint64_t t = CFrameProfiler::Now();
+		WriteChip(w);
+		m_OutProfiler.AddChipTime(static_cast<CFrameProfiler::CHIP>(w.Chip), t);
+	}
+	return;
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+#include <thread>
+#include "CSpscQueue.h"
+#include "CFrameScheduler.h"
+#include "CFrameProfiler.h"
+
+class RmmChipMuse;
+
+/** 音源チップへの書き込みの出口
+ * 先読みしない場合は、呼び出したスレッドでそのまま実チップに書き込む。
+ * 先読みする場合は、演奏スレッドは最大 K フレーム先まで実行して書き込みをフレームごとにキューへ積み、
+ * 出力スレッドが各フレームの期限ちょうどにまとめて実チップへ書き込む。
+ * 重いフレームがあっても先読みの余裕を食うだけで、音の出るタイミングは乱れない。
+ * 期限に間に合わない状態が続くときは、実チップの値と同じ値の書き込みを省いて負荷を下げる（テンポは落とさない）。
+ */
+class CChipPipeline
+{
+public:
+	enum OP { OP_REG, OP_ADDR, OP_DATA, OP_FRAME };
+	struct CHIPWRITE
+	{
+		RmmChipMuse		*pChip;
+		uint16_t		Addr;
+		uint8_t			Data;
+		uint8_t			Op;
+		uint8_t			Chip;		// CFrameProfiler::CHIP
+	};
+	static const int MAX_LOOKAHEAD = 16;
+
+private:
+	static const size_t QUEUE_SIZE = 1 << 15;
+	CSpscQueue<CHIPWRITE, QUEUE_SIZE> m_Queue;
+	bool					m_bPipelined;
+	int						m_Lookahead;
+	bool					m_bPending;		// 前回のフレームの区切り以降に積んだ書き込みがある
+	std::atomic<uint32_t>	m_Produced;		// 積んだフレーム数
+	std::atomic<uint32_t>	m_Consumed;		// 書き込み終えたフレーム数
+	std::atomic<bool>		m_bQuit;
+	std::atomic<bool>		m_bResetTiming;
+	std::atomic<bool>		m_bOverloaded;	// 期限に間に合っていない（同じ値の書き込みを省く）
+	std::atomic<uint64_t>	m_Skipped;		// 省いた書き込みの数
+	std::thread				m_Thread;
+	int						m_Priority, m_Cpu;
+	CFrameProfiler			*m_pProfiler;	// 先読みしない場合の計測先（演奏スレッドのもの）
+	// 以下は出力スレッドだけが使う
+	CFrameScheduler			m_Sched;
+	CFrameProfiler			m_OutProfiler;
+
+public:
+	explicit CChipPipeline(const int64_t periodNs);
+	virtual ~CChipPipeline();
+
+public:
+	void SetProfiler(CFrameProfiler *pProfiler);
+	void Start(const int lookahead, const int priority, const int cpu);
+	void Stop();
+	bool IsPipelined() const;
+	void EndFrame();
+	void Flush();
+	void ResetTiming();
+	void SetFramePeriod(const int64_t periodNs);
+	const CFrameScheduler::STATS &GetStats() const;
+	double GetTempoAccuracy() const;
+	void SetOverloaded(const bool bOverloaded);
+	uint64_t GetSkippedWrites() const;
+	void PrintProfile() const;
+	static void WriteChip(const CHIPWRITE &w);
+
+	/** 音源チップへ書き込む（先読みする場合はキューに積む） */
+	void Write(
+		RmmChipMuse *pChip, const CFrameProfiler::CHIP chip, const OP op, const uint16_t addr, const uint8_t data)
+	{
+		CHIPWRITE w;
+		w.pChip = pChip;
+		w.Addr = addr;
+		w.Data = data;
+		w.Op = static_cast<uint8_t>(op);
+		w.Chip = static_cast<uint8_t>(chip);
+		if( m_bPipelined ){
+			push(w);
+			m_bPending = true;
+			return;
+		}
+		const uint64_t t = (m_pProfiler != nullptr) ? CFrameProfiler::Now() : 0;
+		WriteChip(w);
+		if( m_pProfiler != nullptr )
+			m_pProfiler->AddChipTime(chip, t);
+		return;
+	}
+
+	/** 過負荷のときは、実チップに書き込み済みの値 out と同じ値 b の書き込みを省く（省くなら true） */
+	bool SkipRedundant(const uint8_t out, const uint8_t b)
+	{
+		if( out != b || !m_bOverloaded.load(std::memory_order_relaxed) )
+			return false;
+		m_Skipped.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+private:
+	void push(const CHIPWRITE &w);
+	void outputThread();
+};
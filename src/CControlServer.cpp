@@ -0,0 +1,303 @@
+﻿#include "stdafx.h"
+#include "tools.h"
+#include "CControlServer.h"
+#ifdef __linux
+#include <sys/un.h>
+#include <poll.h>
+#include <errno.h>
+#include <sys/stat.h>
+#endif
+
+static const int POLL_TIMEOUT = 200;	// [ms] 終了要求を確認する間隔
+static const int FRAME_TIME_US = 16600;	// [us] 1フレームの時間
+static const size_t MAX_CLIENTS = 16;	// 同時に接続できるクライアントの数
+static const size_t MAX_LINE = 256;		// １行の最大の長さ（超えたら切断する）
+
+CControlServer::CControlServer() :
+	m_ListenFd(-1), m_bQuit(false),
+	m_State(STATE_STOPPED), m_SongNo(0), m_SongNum(0), m_Frame(0), m_Volume(15), m_Tempo(10000), m_Rate(100)
+{
+	return;
+}
+
+CControlServer::~CControlServer()
+{
+	Stop();
+	return;
+}
+
+/** 指定パスにソケットを作って、受け付けを開始する
+ */
+bool CControlServer::Start(const tstring &sockPath)
+{
+#ifdef __linux
+	t_ToNarrow(sockPath, &m_SockPath);
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	if( sizeof(addr.sun_path) <= m_SockPath.size() )
+		return false;
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, m_SockPath.c_str(), sizeof(addr.sun_path)-1);
+
+	if( !removeStaleSocket(addr) )
+		return false;
+	m_ListenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if( m_ListenFd < 0 )
+		return false;
+	if( ::bind(m_ListenFd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+		::listen(m_ListenFd, 4) != 0 ){
+		::close(m_ListenFd);
+		m_ListenFd = -1;
+		return false;
+	}
+	m_bQuit = false;
+	m_Thread = std::thread(&CControlServer::serverThread, this);
+	return true;
+#else
+	return false;
+#endif
+}
+
+#ifdef __linux
+/** 前回の実行で残ったソケットだけを消す
+ * ソケット以外のファイルや、他のプロセスが受け付け中のソケットは消さずに false を返す。
+ */
+bool CControlServer::removeStaleSocket(const struct sockaddr_un &addr)
+{
+	struct stat st;
+	if( ::lstat(addr.sun_path, &st) != 0 )
+		return errno == ENOENT;
+	if( !S_ISSOCK(st.st_mode) ){
+		std::wcout << _T("Not a socket: ") << addr.sun_path << _T("\n");
+		return false;
+	}
+	int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if( fd < 0 )
+		return false;
+	const bool bAlive = ::connect(fd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) == 0;
+	::close(fd);
+	if( bAlive ){
+		std::wcout << _T("The socket is in use: ") << addr.sun_path << _T("\n");
+		return false;
+	}
+	return ::unlink(addr.sun_path) == 0;
+}
+#endif
+
+void CControlServer::Stop()
+{
+	m_bQuit = true;
+	if( m_Thread.joinable() )
+		m_Thread.join();
+#ifdef __linux
+	if( 0 <= m_ListenFd ){
+		::close(m_ListenFd);
+		m_ListenFd = -1;
+		::unlink(m_SockPath.c_str());
+	}
+#endif
+	return;
+}
+
+/** 演奏側スレッドから呼び出す。コマンドが無ければ false
+ */
+bool CControlServer::PopCommand(HSZCOMMAND *pCmd)
+{
+	return m_Commands.Pop(pCmd);
+}
+
+void CControlServer::SetState(const STATE st)
+{
+	m_State.store(st, std::memory_order_relaxed);
+	return;
+}
+
+void CControlServer::SetSong(const int songNo, const int songNum, const tstring &title)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_TitleLock);
+		m_Title = title;
+	}
+	m_SongNo.store(songNo, std::memory_order_relaxed);
+	m_SongNum.store(songNum, std::memory_order_relaxed);
+	return;
+}
+
+void CControlServer::SetFrame(const uint32_t frame)
+{
+	m_Frame.store(frame, std::memory_order_relaxed);
+	return;
+}
+
+void CControlServer::SetVolume(const int vol)
+{
+	m_Volume.store(vol, std::memory_order_relaxed);
+	return;
+}
+
+/** テンポの正確さ[%]
+ */
+void CControlServer::SetTempo(const double tempo)
+{
+	m_Tempo.store(static_cast<int>(tempo * 100 + 0.5), std::memory_order_relaxed);
+	return;
+}
+
+/** 演奏の速さ[%]
+ */
+void CControlServer::SetRate(const int rate)
+{
+	m_Rate.store(rate, std::memory_order_relaxed);
+	return;
+}
+
+/** 受け付け用のソケットと接続中のすべてのクライアントを同時に待つ
+ * つながったまま何も送ってこないクライアントがいても、他のクライアントのコマンドは受け付ける。
+ */
+void CControlServer::serverThread()
+{
+#ifdef __linux
+	std::vector<CLIENT> clients;
+	std::vector<struct pollfd> pfds;
+	while( !m_bQuit ){
+		pfds.clear();
+		pfds.push_back(pollfd{ m_ListenFd, POLLIN, 0 });
+		for( auto &c : clients )
+			pfds.push_back(pollfd{ c.Fd, POLLIN, 0 });
+		if( ::poll(pfds.data(), pfds.size(), POLL_TIMEOUT) <= 0 )
+			continue;
+		// 後ろから見て、切断したクライアントを取り除く
+		for( size_t t = clients.size(); 0 < t; --t ){
+			if( pfds[t].revents == 0 || receive(&clients[t-1]) )
+				continue;
+			::close(clients[t-1].Fd);
+			clients.erase(clients.begin() + (t-1));
+		}
+		if( (pfds[0].revents & POLLIN) == 0 )
+			continue;
+		int fd = ::accept(m_ListenFd, nullptr, nullptr);
+		if( fd < 0 )
+			continue;
+		if( MAX_CLIENTS <= clients.size() ){
+			static const char RES[] = "ERR too many clients\n";
+			::send(fd, RES, sizeof(RES)-1, MSG_NOSIGNAL|MSG_DONTWAIT);
+			::close(fd);
+			continue;
+		}
+		CLIENT c;
+		c.Fd = fd;
+		clients.push_back(c);
+	}
+	for( auto &c : clients )
+		::close(c.Fd);
+#endif
+	return;
+}
+
+/** 受信したぶんを処理する。１行１コマンドで受け取り、１行で応答する
+ * @return 切断された場合は false
+ */
+bool CControlServer::receive(CLIENT *pClient)
+{
+#ifdef __linux
+	char buff[256];
+	ssize_t len = ::recv(pClient->Fd, buff, sizeof(buff), MSG_DONTWAIT);
+	if( len < 0 && (errno == EAGAIN || errno == EINTR) )
+		return true;
+	if( len <= 0 )
+		return false;
+	for( ssize_t t = 0; t < len; ++t ){
+		if( buff[t] == '\r' )
+			continue;
+		if( buff[t] != '\n' ){
+			if( MAX_LINE <= pClient->Line.size() ){
+				static const char RES[] = "ERR line too long\n";
+				::send(pClient->Fd, RES, sizeof(RES)-1, MSG_NOSIGNAL|MSG_DONTWAIT);
+				return false;
+			}
+			pClient->Line += buff[t];
+			continue;
+		}
+		std::string res = execute(pClient->Line) + "\n";
+		// 応答を読まないクライアントで止まらないように、送れなければ捨てる
+		::send(pClient->Fd, res.c_str(), res.size(), MSG_NOSIGNAL|MSG_DONTWAIT);
+		pClient->Line.clear();
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::string CControlServer::execute(const std::string &line)
+{
+	auto sp = line.find(' ');
+	std::string cmd = line.substr(0, sp);
+	std::string arg;
+	if( sp != std::string::npos ){
+		auto top = line.find_first_not_of(' ', sp);
+		if( top != std::string::npos )
+			arg = line.substr(top);
+	}
+
+	if( cmd == "status" ){
+		static const char *STATES[] = { "stopped", "playing", "paused" };
+		std::string title;
+		{
+			std::lock_guard<std::mutex> lock(m_TitleLock);
+			t_ToNarrow(m_Title, &title);
+		}
+		const int tempo = m_Tempo.load(std::memory_order_relaxed);
+		std::ostringstream os;
+		os	<< "OK state=" << STATES[m_State.load(std::memory_order_relaxed)]
+			<< " song=" << m_SongNo.load(std::memory_order_relaxed)+1
+			<< "/" << m_SongNum.load(std::memory_order_relaxed)
+			<< " frame=" << m_Frame.load(std::memory_order_relaxed)
+			<< " volume=" << m_Volume.load(std::memory_order_relaxed)
+			<< " rate=" << m_Rate.load(std::memory_order_relaxed) << "%"
+			<< " tempo=" << tempo/100 << "." << std::setw(2) << std::setfill('0') << tempo%100 << "%"
+			<< " title=" << title;
+		return os.str();
+	}
+
+	HSZCOMMAND c;
+	if( cmd == "play" ){
+		c.Type = HSZCOMMAND::PLAY;
+		t_ToWiden(arg, &c.Path);
+	}
+	else if( cmd == "stop" )
+		c.Type = HSZCOMMAND::STOP;
+	else if( cmd == "next" )
+		c.Type = HSZCOMMAND::NEXT;
+	else if( cmd == "pause" )
+		c.Type = HSZCOMMAND::PAUSE;
+	else if( cmd == "resume" )
+		c.Type = HSZCOMMAND::RESUME;
+	else if( cmd == "seek" ){
+		double sec;
+		if( !t_ParseTime(arg, &sec) )
+			return "ERR seek needs a time ([min:]sec)";
+		c.Type = HSZCOMMAND::SEEK;
+		c.Value = static_cast<int>(sec * 1000000 / FRAME_TIME_US);
+	}
+	else if( cmd == "volume" ){
+		if( arg.empty() )
+			return "ERR volume needs a value (0-15)";
+		c.Type = HSZCOMMAND::VOLUME;
+		c.Value = t_Trimer(atoi(arg.c_str()), 0, 15);
+	}
+	else if( cmd == "rate" ){
+		if( arg.empty() )
+			return "ERR rate needs a value (0.25-4)";
+		c.Type = HSZCOMMAND::RATE;
+		c.Value = t_Trimer(static_cast<int>(atof(arg.c_str()) * 100 + 0.5), 25, 400);
+	}
+	else if( cmd == "quit" )
+		c.Type = HSZCOMMAND::QUIT;
+	else
+		return "ERR unknown command";
+
+	if( !m_Commands.Push(c) )
+		return "ERR busy";
+	return "OK";
+}
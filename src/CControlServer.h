@@ -0,0 +1,75 @@
+#pragma once
+#include "stdafx.h"
+#include "CSpscQueue.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct sockaddr_un;
+
+/** 制御コマンド
+ */
+struct HSZCOMMAND
+{
+	enum TYPE { PLAY, STOP, NEXT, PAUSE, RESUME, SEEK, VOLUME, RATE, QUIT };
+	TYPE	Type;
+	int		Value;		// VOLUME=音量、SEEK=フレーム番号、RATE=演奏の速さ[%]
+	tstring	Path;
+	HSZCOMMAND() : Type(STOP), Value(0) { return; }
+};
+
+/** Unix-domain socket で制御コマンドを受け付ける
+ * 受け付けたコマンドはロックフリーのキューに積み、演奏側のスレッドが１フレームに１回取り出す。
+ * 状態の問い合わせ(status)には、演奏側が毎フレーム更新する値を使ってこのスレッド内で答える。
+ */
+class CControlServer
+{
+public:
+	enum STATE { STATE_STOPPED, STATE_PLAYING, STATE_PAUSED };
+
+private:
+	struct CLIENT
+	{
+		int			Fd;
+		std::string	Line;		// 改行を待っている受信途中の行
+	};
+	std::string m_SockPath;
+	int m_ListenFd;
+	std::thread m_Thread;
+	std::atomic<bool> m_bQuit;
+	CSpscQueue<HSZCOMMAND, 64> m_Commands;
+
+	// 演奏側から公開される状態
+	std::atomic<int> m_State;
+	std::atomic<int> m_SongNo;
+	std::atomic<int> m_SongNum;
+	std::atomic<uint32_t> m_Frame;
+	std::atomic<int> m_Volume;
+	std::atomic<int> m_Tempo;		// テンポの正確さ [0.01%]
+	std::atomic<int> m_Rate;		// 演奏の速さ [%]
+	std::mutex m_TitleLock;
+	tstring m_Title;
+
+public:
+	CControlServer();
+	virtual ~CControlServer();
+
+public:
+	bool Start(const tstring &sockPath);
+	void Stop();
+	bool PopCommand(HSZCOMMAND *pCmd);
+
+	void SetState(const STATE st);
+	void SetSong(const int songNo, const int songNum, const tstring &title);
+	void SetFrame(const uint32_t frame);
+	void SetVolume(const int vol);
+	void SetTempo(const double tempo);
+	void SetRate(const int rate);
+
+private:
+	bool removeStaleSocket(const struct sockaddr_un &addr);
+	void serverThread();
+	bool receive(CLIENT *pClient);
+	std::string execute(const std::string &line);
+};
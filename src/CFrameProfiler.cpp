@@ -0,0 +1,136 @@
+﻿#include "stdafx.h"
+#include "CFrameProfiler.h"
+
+CFrameProfiler::CFrameProfiler()
+{
+	m_bInFrame = false;
+	m_bWaiting = false;
+	m_FrameBegin = 0;
+	m_WaitBegin = 0;
+	m_InstBegin = 0;
+	for( int t = 0; t < CHIP_NUM; ++t )
+		m_ChipNs[t] = 0;
+	return;
+}
+
+CFrameProfiler::~CFrameProfiler()
+{
+	// do nothing
+	return;
+}
+
+/** ST16MS で呼ぶ
+ * @param instCount それまでに実行した命令数
+ */
+void CFrameProfiler::BeginFrame(const uint64_t instCount)
+{
+	m_FrameBegin = Now();
+	m_InstBegin = instCount;
+	for( int t = 0; t < CHIP_NUM; ++t )
+		m_ChipNs[t] = 0;
+	m_bInFrame = true;
+	return;
+}
+
+/** WT16MS で呼び、Z80の実行時間（音源チップへの書き込みを除く）と命令数を記録する
+ */
+void CFrameProfiler::EndEmulation(const uint64_t instCount)
+{
+	if( !m_bInFrame )
+		return;
+	m_bInFrame = false;
+	uint64_t chipNs = 0;
+	for( int t = 0; t < CHIP_NUM; ++t )
+		chipNs += m_ChipNs[t];
+	const uint64_t elapsed = Now() - m_FrameBegin;
+	m_Hist[HIST_EMULATION].Record((chipNs < elapsed) ? elapsed - chipNs : 0);
+	m_Hist[HIST_INSTRUCTIONS].Record(instCount - m_InstBegin);
+	return;
+}
+
+/** 1フレーム分の音源チップへの書き込み時間を記録して、次のフレームに備える
+ */
+void CFrameProfiler::RecordChips()
+{
+	m_Hist[HIST_OPLL].Record(m_ChipNs[CHIP_OPLL]);
+	m_Hist[HIST_PSG].Record(m_ChipNs[CHIP_PSG]);
+	m_Hist[HIST_SCC].Record(m_ChipNs[CHIP_SCC]);
+	for( int t = 0; t < CHIP_NUM; ++t )
+		m_ChipNs[t] = 0;
+	return;
+}
+
+/** フレームの期限まで待ち始める前に呼ぶ
+ */
+void CFrameProfiler::BeginWait()
+{
+	m_WaitBegin = Now();
+	m_bWaiting = true;
+	return;
+}
+
+/** 待ち終わってから呼ぶ
+ * @param requestedNs 待つべきだった時間（期限を過ぎていたら 0 以下）
+ */
+void CFrameProfiler::EndWait(const int64_t requestedNs)
+{
+	if( !m_bWaiting )
+		return;
+	m_bWaiting = false;
+	const uint64_t req = (0 < requestedNs) ? static_cast<uint64_t>(requestedNs) : 0;
+	const uint64_t act = Now() - m_WaitBegin;
+	m_Hist[HIST_SLEEP_REQ].Record(req);
+	m_Hist[HIST_SLEEP_ACT].Record(act);
+	m_Hist[HIST_OVERSLEEP].Record((req < act) ? act - req : 0);
+	return;
+}
+
+/** 測定中のフレームを捨てる（シークや一時停止で、フレームが途切れるとき）
+ */
+void CFrameProfiler::Cancel()
+{
+	m_bInFrame = false;
+	m_bWaiting = false;
+	return;
+}
+
+void CFrameProfiler::Reset()
+{
+	for( int t = 0; t < HIST_NUM; ++t )
+		m_Hist[t].Reset();
+	return;
+}
+
+const CHistogram &CFrameProfiler::GetHistogram(const HIST h) const
+{
+	return m_Hist[h];
+}
+
+/** 各ヒストグラムの要約（平均と百分位点）を表示する（記録の無いものは省く）
+ */
+void CFrameProfiler::Print(const TCHAR *pTitle) const
+{
+	static const TCHAR *NAMES[HIST_NUM] = {
+		_T("emulation"), _T("opll write"), _T("psg write"), _T("scc write"),
+		_T("sleep req"), _T("sleep act"), _T("oversleep"), _T("instructions"),
+	};
+	::wprintf(_T("%-13ls %8ls %8ls %8ls %8ls %8ls %8ls %8ls\n"),
+		pTitle, _T("count"), _T("mean"), _T("p50"), _T("p90"), _T("p99"), _T("p99.9"), _T("max"));
+	for( int t = 0; t < HIST_NUM; ++t ){
+		const CHistogram &h = m_Hist[t];
+		if( h.GetCount() == 0 )
+			continue;
+		// 命令数以外は us で表示する
+		const uint64_t div = (t == HIST_INSTRUCTIONS) ? 1 : 1000;
+		::wprintf(_T("%-13ls %8llu %8llu %8llu %8llu %8llu %8llu %8llu\n"),
+			NAMES[t],
+			static_cast<unsigned long long>(h.GetCount()),
+			static_cast<unsigned long long>(h.GetMean() / div),
+			static_cast<unsigned long long>(h.GetPercentile(50.0) / div),
+			static_cast<unsigned long long>(h.GetPercentile(90.0) / div),
+			static_cast<unsigned long long>(h.GetPercentile(99.0) / div),
+			static_cast<unsigned long long>(h.GetPercentile(99.9) / div),
+			static_cast<unsigned long long>(h.GetMax() / div));
+	}
+	return;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "stdafx.h"
+#include "CHistogram.h"
+#ifdef __linux
+#include <time.h>
+#endif
+#include <chrono>
+
+/** フレーム（ST16MS から次の ST16MS まで）ごとの処理時間の内訳を測る
+ * 1フレームの間は合計を数えるだけにして、ヒストグラムへはフレームの終わりにまとめて記録する。
+ * 記録は１スレッドから行う（パイプライン実行時は、演奏スレッドと出力スレッドが別々のインスタンスを使う）。
+ * 時刻は CLOCK_MONOTONIC_RAW（NTP の調整を受けない）で測る。
+ */
+class CFrameProfiler
+{
+public:
+	enum CHIP { CHIP_OPLL, CHIP_PSG, CHIP_SCC, CHIP_NUM };
+	enum HIST
+	{
+		HIST_EMULATION,		// Z80の実行（音源チップへの書き込みを除く）[ns]
+		HIST_OPLL,			// OPLLへの書き込み [ns]
+		HIST_PSG,			// PSGへの書き込み [ns]
+		HIST_SCC,			// SCCへの書き込み [ns]
+		HIST_SLEEP_REQ,		// WT16MSで待つべき時間 [ns]
+		HIST_SLEEP_ACT,		// WT16MSで実際に待った時間 [ns]
+		HIST_OVERSLEEP,		// 待ちすぎた時間 [ns]
+		HIST_INSTRUCTIONS,	// 実行した命令数
+		HIST_NUM
+	};
+
+private:
+	CHistogram	m_Hist[HIST_NUM];
+	bool		m_bInFrame;
+	bool		m_bWaiting;
+	uint64_t	m_FrameBegin;
+	uint64_t	m_WaitBegin;
+	uint64_t	m_ChipNs[CHIP_NUM];
+	uint64_t	m_InstBegin;
+
+public:
+	CFrameProfiler();
+	virtual ~CFrameProfiler();
+
+public:
+	void BeginFrame(const uint64_t instCount);
+	void EndEmulation(const uint64_t instCount);
+	void RecordChips();
+	void BeginWait();
+	void EndWait(const int64_t requestedNs);
+	void Cancel();
+	void Reset();
+	void Print(const TCHAR *pTitle) const;
+	const CHistogram &GetHistogram(const HIST h) const;
+
+	/** 音源チップへの書き込みにかかった時間を足す */
+	void AddChipTime(const CHIP chip, const uint64_t beginNs)
+	{
+		m_ChipNs[chip] += Now() - beginNs;
+		return;
+	}
+
+	static uint64_t Now()
+	{
+#ifdef __linux
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+		return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+};
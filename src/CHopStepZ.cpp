@@ -2,56 +2,107 @@
 #include "CZ80MsxDos.h"
 #include "CMsxMemSlotSystem.h"
 #include "CMsxIoSystem.h"
-#include "CRam256k.h"
+#include "CMsxMemoryMapper.h"
 #include "CMsxMusic.h"
 #include "CScc.h"
+#include "CLoopDetector.h"
+#include "CFrameProfiler.h"
+#include "CChipPipeline.h"
 #include "CHopStepZ.h"
+#include "tools.h"
+
+static const int64_t FRAME_TIME_NS = 16600*1000;	// 16.6ms
+static const double MIN_RATE = 0.25;				// 演奏の速さの範囲
+static const double MAX_RATE = 4.0;
 
 CHopStepZ::CHopStepZ()
 {
 	m_pSlot = nullptr;
 	m_pIo = nullptr;
 	m_pCpu = nullptr;
-	m_pRam256 = nullptr;
+	m_pMapper = nullptr;
 	m_pFm = nullptr;
 	m_pScc = nullptr;
+	m_pLoop = nullptr;
+	m_pProfiler = nullptr;
+	m_pPipeline = nullptr;
+	m_Lookahead = 0;
+	m_Rate = 1.0;
+	m_RateAcc = 0;
+	m_bHeadless = false;
+	m_StartAddr = m_StackAddr = 0;
+	m_Volume = 15;
+	m_FadeLoops = 0;
+	m_FadeVolume = -1;
+	m_FadeStartFrame = 0;
 	return;
 }
 CHopStepZ::~CHopStepZ()
 {
+	// 音源の消音は、出力スレッドを止めてから直接書き込む
+	StopPipeline();
 	NULL_DELETE(m_pCpu);
-	NULL_DELETE(m_pRam256);
+	NULL_DELETE(m_pMapper);
 	NULL_DELETE(m_pFm);
 	NULL_DELETE(m_pScc);
 	NULL_DELETE(m_pSlot);
 	NULL_DELETE(m_pIo);
+	NULL_DELETE(m_pLoop);
+	NULL_DELETE(m_pPipeline);
+	NULL_DELETE(m_pProfiler);
 	return;
 }
 
-void CHopStepZ::Setup()
+/**
+ * @param bHeadless true なら音源チップにアクセスせず、ウェイトも入れずに最速で実行する
+ * @param mapperSegments メモリマッパのセグメント数（16KBytes単位、4～256）
+ */
+void CHopStepZ::Setup(const bool bHeadless, const int mapperSegments)
 {
+	m_bHeadless = bHeadless;
 	m_pSlot = GCC_NEW CMsxMemSlotSystem();
 	m_pIo = GCC_NEW CMsxIoSystem();
 	m_pIo->JoinObject(m_pIo);
 	m_pIo->JoinObject(m_pSlot);
-	// device - 256k ram #3-0
-	m_pRam256 = GCC_NEW CRam256k(0xc9);
-	m_pSlot->JoinObject(SLOTNO_3, SLOTNO_0, m_pRam256);
-	m_pIo->JoinObject(m_pRam256);
+	// device - memory mapper ram #3-0
+	m_pMapper = GCC_NEW CMsxMemoryMapper(mapperSegments, 0xc9);
+	m_pSlot->JoinObject(SLOTNO_3, SLOTNO_0, m_pMapper);
+	m_pIo->JoinObject(m_pMapper);
 	// device - fm-bios #0-2
-	m_pFm = GCC_NEW CMsxMusic();
+	m_pFm = GCC_NEW CMsxMusic(bHeadless);
 	m_pSlot->JoinObject(SLOTNO_0, SLOTNO_2, m_pFm);
 	m_pIo->JoinObject(m_pFm);
 	// device - scc #1-0
-	m_pScc = GCC_NEW CScc();
+	m_pScc = GCC_NEW CScc(bHeadless);
 	m_pSlot->JoinObject(SLOTNO_1, SLOTNO_0, m_pScc);
 	// CPU
 	m_pCpu = GCC_NEW CZ80MsxDos();
-	m_pCpu->SetSubSystem(m_pSlot, m_pIo);	
+	m_pCpu->SetSubSystem(m_pSlot, m_pIo);
+	m_pCpu->SetMemoryMapper(m_pMapper);
+	m_pCpu->SetHeadless(bHeadless);
+	// ヘッドレスは実時間と関係なく最速で実行するので、時刻は実行したTステート数から求める
+	m_pCpu->GetClock()->SetMode(bHeadless ? CMsxClock::MODE_VIRTUAL : CMsxClock::MODE_REALTIME);
+	m_pIo->SetClock(m_pCpu->GetClock());
+	// ループ検出（MGSDRVはページ1のRAMにワークを持つ）
+	m_pLoop = GCC_NEW CLoopDetector();
+	m_pSlot->SetLoopDetector(m_pLoop, 0x4000, 0x7FFF);
+	m_pFm->SetLoopDetector(m_pLoop);
+	m_pScc->SetLoopDetector(m_pLoop);
+	m_pCpu->SetLoopDetector(m_pLoop);
+	// フレームごとの処理時間の計測（常に有効にしておく）
+	// 音源チップへの書き込みの出口（StartPipeline()までは、書き込みはすぐに実チップへ送る）
+	if( !bHeadless ){
+		m_pProfiler = GCC_NEW CFrameProfiler();
+		m_pPipeline = GCC_NEW CChipPipeline(FRAME_TIME_NS);
+		m_pPipeline->SetProfiler(m_pProfiler);
+		m_pFm->SetChipOutput(m_pPipeline);
+		m_pScc->SetChipOutput(m_pPipeline);
+		m_pCpu->SetProfiler(m_pProfiler);
+		m_pCpu->SetChipPipeline(m_pPipeline);
+	}
 
 	// メモリセットアップ
-	for( int t = 0; t < 0xf0; ++t)
-		m_pSlot->Write(t, 0x00);
+	m_pSlot->FillBlock(0x0000, 0x00, 0xf0);
 	// ページnのRAMのスロットアドレス
 	m_pSlot->Write(0xF341, 0x83);	// Page.0
 	m_pSlot->Write(0xF342, 0x83);	// Page.1
@@ -85,19 +136,382 @@ void CHopStepZ::MemoryWrite(const z80memaddr_t addr, const std::vector<uint8_t>
 	return;
 }
 
-void CHopStepZ::Run(const z80memaddr_t startAddr, const z80memaddr_t stackAddr, bool *pStop)
+void CHopStepZ::Run(const z80memaddr_t startAddr, const z80memaddr_t stackAddr, const std::atomic<bool> *pStop)
 {
+	Start(startAddr, stackAddr);
+	while( RunFrame(pStop) )
+		;
+	return;
+}
+
+/** プログラムの実行を開始する準備をする（実行は RunFrame() で行う）
+ */
+void CHopStepZ::Start(const z80memaddr_t startAddr, const z80memaddr_t stackAddr)
+{
+	if( 0 <= m_FadeVolume ){
+		// フェードアウトの途中で曲を切り替えたので、音量を戻しておく
+		setVolume(m_Volume);
+		m_FadeVolume = -1;
+	}
+	m_StartAddr = startAddr;
+	m_StackAddr = stackAddr;
 	m_pSlot->Write(0x0006, (stackAddr>>0)&0xff);
 	m_pSlot->Write(0x0007, (stackAddr>>8)&0xff);
-	m_pCpu->Push16(0x0000);
 	m_pCpu->ResetCpu(startAddr, stackAddr);
+	m_pCpu->Push16(0x0000);
+	return;
+}
+
+/** 1フレーム(WT16MSの呼び出し、またはVSYNC割り込み)分、実行する
+ * @return プログラムが終了したか、曲が終わったか、停止要求があった場合は false
+ * 割り込み禁止の HALT などで先に進めなくなった場合も、空回りせずに false を返す
+ */
+bool CHopStepZ::RunFrame(const std::atomic<bool> *pStop)
+{
+	const bool bRet = runFrame(pStop);
+	if( isCoalescing() ){
+		// 等倍より速いときは、実時間の１フレーム分ごとに、その間の書き込みをまとめて差分だけ書き込む
+		m_RateAcc += 1.0 / m_Rate;
+		if( 1.0 <= m_RateAcc || !bRet ){
+			m_RateAcc = (1.0 <= m_RateAcc) ? m_RateAcc - 1.0 : 0;
+			resyncChips();
+		}
+	}
+	return bRet;
+}
 
-	while( m_pCpu->GetPC() != 0 && (pStop==nullptr||!*pStop)) {
+bool CHopStepZ::runFrame(const std::atomic<bool> *pStop)
+{
+	const uint32_t frame = m_pCpu->GetFrameCount();
+	for(;;){
+		if( m_pCpu->GetPC() == 0 || m_pCpu->IsSongEnd() || m_pCpu->IsStalled() || (pStop!=nullptr && *pStop) )
+			return false;
+		if( m_pCpu->GetFrameCount() != frame )
+			return updateFade();
 	 	m_pCpu->Execution();
 	}
+}
+
+/** 指定フレームまで、音源チップに書き込まずにウェイトなしで実行し、
+ * 最後にレジスタの差分だけを音源チップに書き込む。
+ * 今より前に戻る場合は、Start() からやり直す。
+ * @return 指定フレームに着く前に曲が終わった場合は false
+ */
+bool CHopStepZ::Seek(const uint32_t frame, const std::atomic<bool> *pStop)
+{
+	if( frame < m_pCpu->GetFrameCount() )
+		Start(m_StartAddr, m_StackAddr);
+	m_pCpu->SetHeadless(true);
+	setChipOutput(false);
+	bool bRet = true;
+	while( bRet && m_pCpu->GetFrameCount() < frame )
+		bRet = runFrame(pStop);
+	m_pCpu->SetHeadless(m_bHeadless);
+	setChipOutput(!isCoalescing());
+	resyncChips();
+	return bRet;
+}
+
+/** PLAYER.COM の起動からのフレーム数
+ */
+uint32_t CHopStepZ::GetFrameCount() const
+{
+	return m_pCpu->GetFrameCount();
+}
+
+uint64_t CHopStepZ::GetInstCount() const
+{
+	return m_pCpu->GetInstCount();
+}
+
+/** MGSDRV のマスターボリュームを設定する
+ * 曲を切り替えても（PLAYER.COM を起動し直しても）この音量のままにする。
+ * @param vol 0(無音)～15(最大)
+ * @param bNow false なら、次に PLAYER.COM を起動したときから効かせる（演奏していない間用）
+ */
+void CHopStepZ::SetMasterVolume(const int vol, const bool bNow)
+{
+	m_Volume = t_Trimer(vol, 0, 15);
+	m_pCpu->SetMgsVolume(m_Volume);
+	if( bNow && m_FadeVolume < 0 )
+		setVolume(m_Volume);
+	return;
+}
+
+void CHopStepZ::setVolume(const int vol)
+{
+	m_pCpu->CallMgsMasterVolume(vol);
 	return;
 }
 
+/** 指定回数ループしたら、フェードアウトして曲を終える（0=しない）
+ * MGSDRVに渡すループ回数は無限(0xFF)にしておくこと。
+ */
+void CHopStepZ::SetFadeLoops(const int loops)
+{
+	m_FadeLoops = loops;
+	return;
+}
+
+/** 検出した曲のループ位置
+ * @return まだ検出できていない場合は false
+ */
+bool CHopStepZ::GetLoopInfo(uint32_t *pIntroFrames, uint32_t *pLoopFrames) const
+{
+	if( !m_pLoop->IsDetected() )
+		return false;
+	*pIntroFrames = m_pLoop->GetIntroFrames();
+	*pLoopFrames = m_pLoop->GetLoopFrames();
+	return true;
+}
+
+/** 演奏中にページフォルトが起きないよう、エミュレータのメモリを触っておく
+ */
+void CHopStepZ::Prefault()
+{
+	m_pMapper->Prefault();
+	return;
+}
+
+/** 以降、他のインスタンスから ShareMemory() でメモリを共有できるようにする
+ * 共有させている間も書き込めるが、書き込んだセグメントは複製される。
+ */
+void CHopStepZ::FreezeMemory()
+{
+	m_pMapper->Freeze();
+	return;
+}
+
+/** FreezeMemory() した tmpl と内容が同じメモリマッパのセグメントを、コピーオンライトで共有する
+ * 同じドライバを常駐させたインスタンスどうしなら、常駐後に書き換えないセグメントの分だけメモリが減る。
+ * @return 共有に切り替えたセグメントの数
+ */
+int CHopStepZ::ShareMemory(const CHopStepZ &tmpl)
+{
+	return m_pMapper->ShareSegments(*tmpl.m_pMapper);
+}
+
+/** メモリ装置を仮想関数を通さずに呼び出すかどうか（既定は true。false は速さの比較用）
+ */
+void CHopStepZ::SetStaticDispatch(const bool bStatic)
+{
+	m_pSlot->SetStaticDispatch(bStatic);
+	return;
+}
+
+/** 一時停止から再開するときに呼び、演奏のテンポの基点を置き直す
+ */
+void CHopStepZ::ResetFrameTiming()
+{
+	m_pCpu->ResetFrameTiming();
+	return;
+}
+
+/** 演奏の速さを変える（0.25～4.0倍、音程は変わらない）
+ * フレームの周期を縮めたり伸ばしたりする。VSYNC割り込みの周期は Z80 の時間なので変えない。
+ * 等倍より速いときは、音源チップへの書き込みを実時間の１フレーム分ずつまとめて、
+ * 上書きされた書き込みを省く（チップへの書き込み量を等倍のときと同じ程度に抑える）。
+ */
+void CHopStepZ::SetPlaybackRate(const double rate)
+{
+	m_Rate = (rate < MIN_RATE) ? MIN_RATE : (MAX_RATE < rate) ? MAX_RATE : rate;
+	m_RateAcc = 0;
+	m_pCpu->SetFramePeriod(static_cast<int64_t>(FRAME_TIME_NS / m_Rate));
+	setChipOutput(!isCoalescing());
+	resyncChips();
+	return;
+}
+
+double CHopStepZ::GetPlaybackRate() const
+{
+	return m_Rate;
+}
+
+bool CHopStepZ::isCoalescing() const
+{
+	return !m_bHeadless && 1.0 < m_Rate;
+}
+
+void CHopStepZ::setChipOutput(const bool bOutput)
+{
+	m_pFm->SetOutput(bOutput);
+	m_pScc->SetOutput(bOutput);
+	return;
+}
+
+/** 実チップに書き込んでいないレジスタの差分を書き込む
+ */
+void CHopStepZ::resyncChips()
+{
+	m_pFm->Resync();
+	m_pScc->Resync();
+	return;
+}
+
+/** システムタイマー(E6h/E7h)などの時刻を、実時間にするか実行したTステート数から求めるか
+ */
+void CHopStepZ::SetClockMode(const CMsxClock::MODE mode)
+{
+	m_pCpu->GetClock()->SetMode(mode);
+	return;
+}
+
+/** VSYNC割り込み（59.94Hz）を発生させる。H.TIMI から MGS_INTER を呼ぶ PLAYER.COM で使う
+ */
+void CHopStepZ::SetVsyncInterrupt(const bool bEnable)
+{
+	m_pCpu->SetVsyncInterrupt(bEnable ? CMsxClock::FRAME_TSTATES : 0);
+	return;
+}
+
+/** 命令ごとの実行記録を取る（nullptr=取らない）
+ */
+void CHopStepZ::SetTrace(CZ80Trace *pTrace)
+{
+	m_pCpu->SetTrace(pTrace);
+	return;
+}
+
+/** フレームの待ち合わせの統計（先読みした場合は、出力スレッドのもの）
+ */
+const CFrameScheduler::STATS &CHopStepZ::GetFrameStats() const
+{
+	if( 0 < m_Lookahead )
+		return m_pPipeline->GetStats();
+	return m_pCpu->GetFrameStats();
+}
+
+/** 遅れを取り戻せずに失った時間を除いた、テンポの正確さ[%]
+ */
+double CHopStepZ::GetTempoAccuracy() const
+{
+	if( 0 < m_Lookahead )
+		return m_pPipeline->GetTempoAccuracy();
+	return CFrameScheduler::TempoAccuracy(m_pCpu->GetFrameStats());
+}
+
+/** 過負荷のために省いた音源チップへの書き込みの数
+ */
+uint64_t CHopStepZ::GetSkippedWrites() const
+{
+	if( m_pPipeline == nullptr )
+		return 0;
+	return m_pPipeline->GetSkippedWrites();
+}
+
+/** フレームごとの処理時間の内訳を表示する
+ */
+void CHopStepZ::PrintProfile() const
+{
+	if( m_pProfiler != nullptr )
+		m_pProfiler->Print(_T("emulation[us]"));
+	if( 0 < m_Lookahead )
+		m_pPipeline->PrintProfile();
+	return;
+}
+
+/** 演奏スレッドを lookahead フレーム先まで先に実行させ、音源チップへの書き込みは出力スレッドで行う
+ * @param priority 出力スレッドの SCHED_FIFO の優先度（0 なら変えない）
+ * @param cpu 出力スレッドを固定するコアの番号（負の値なら固定しない）
+ */
+void CHopStepZ::StartPipeline(const int lookahead, const int priority, const int cpu)
+{
+	if( m_pPipeline == nullptr || lookahead <= 0 )
+		return;
+	m_Lookahead = lookahead;
+	m_pPipeline->Start(lookahead, priority, cpu);
+	return;
+}
+
+/** 積んである書き込みを出し切ってから、出力スレッドを止める
+ */
+void CHopStepZ::StopPipeline()
+{
+	if( m_pPipeline != nullptr )
+		m_pPipeline->Stop();
+	return;
+}
+
+/** フレームごとに呼び、フェードアウトを進める
+ * @return フェードアウトし終えたら false
+ */
+bool CHopStepZ::updateFade()
+{
+	static const uint32_t FADE_STEP_FRAMES = 20;	// 音量を1段階下げる間隔（15段階で約5秒）
+	if( m_FadeLoops <= 0 )
+		return true;
+	const uint32_t frame = m_pCpu->GetFrameCount();
+	if( m_FadeVolume < 0 ){
+		// ループ位置が分かっていればそこから、分からなければMGSDRVのループ回数で開始する
+		uint32_t intro, loop;
+		bool bStart = GetLoopInfo(&intro, &loop)
+			? (intro + loop * static_cast<uint32_t>(m_FadeLoops) <= frame)
+			: (m_FadeLoops <= m_pCpu->GetMgsLoopCounter());
+		if( !bStart )
+			return true;
+		m_FadeVolume = m_Volume;
+		m_FadeStartFrame = frame;
+	}
+	const int vol = m_Volume - static_cast<int>((frame - m_FadeStartFrame) / FADE_STEP_FRAMES);
+	if( vol < m_FadeVolume ){
+		m_FadeVolume = t_Trimer(vol, 0, 15);
+		setVolume(m_FadeVolume);
+	}
+	if( 0 < m_FadeVolume )
+		return true;
+	// 次の曲のために音量を戻しておく
+	Mute();
+	setVolume(m_Volume);
+	m_FadeVolume = -1;
+	return false;
+}
+
+/** 音源を消音する（曲の切り替え時に使用する）
+ */
+void CHopStepZ::Mute()
+{
+	m_pFm->Mute();
+	m_pScc->Mute();
+	resyncChips();		// 書き込みをまとめている場合
+	// 先読みしている場合も、消音し終えるまで待つ
+	if( m_pPipeline != nullptr )
+		m_pPipeline->Flush();
+	return;
+}
+
+/** 一時停止する。音源は消音するが、エミュレーション上のレジスタの内容は残しておく
+ */
+void CHopStepZ::Pause()
+{
+	m_pFm->Silence();
+	m_pScc->Silence();
+	if( m_pPipeline != nullptr )
+		m_pPipeline->Flush();
+	return;
+}
+
+/** 一時停止から再開する。音源のレジスタを一時停止する前の内容に戻し、テンポの基点を置き直す
+ */
+void CHopStepZ::Resume()
+{
+	resyncChips();
+	ResetFrameTiming();
+	return;
+}
+
+/** 演奏するループ回数（0xFF=無限）
+ */
+void CHopStepZ::SetLoopCount(const uint8_t cnt)
+{
+	m_pCpu->SetMgsLoopCount(cnt);
+	return;
+}
+
+bool CHopStepZ::IsSongEnd() const
+{
+	return m_pCpu->IsSongEnd();
+}
+
 
 
 
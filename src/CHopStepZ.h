@@ -1,12 +1,19 @@
 #pragma once
 #include "stdafx.h"
+#include <atomic>
+#include "CFrameScheduler.h"
+#include "CMsxClock.h"
 
 class CMsxMemSlotSystem;
 class CMsxIoSystem;
 class CZ80MsxDos;
-class CRam256k;
+class CMsxMemoryMapper;
 class CMsxMusic;
 class CScc;
+class CLoopDetector;
+class CFrameProfiler;
+class CChipPipeline;
+class CZ80Trace;
 
 class CHopStepZ
 {
@@ -14,16 +21,65 @@ private:
 	CMsxMemSlotSystem	*m_pSlot;
 	CMsxIoSystem 		*m_pIo;
 	CZ80MsxDos			*m_pCpu;
-	CRam256k			*m_pRam256;
+	CMsxMemoryMapper	*m_pMapper;
 	CMsxMusic			*m_pFm;
 	CScc				*m_pScc;
+	CLoopDetector		*m_pLoop;
+	CFrameProfiler		*m_pProfiler;		// ヘッドレスでは使わない
+	CChipPipeline		*m_pPipeline;		// ヘッドレスでは使わない
+	int					m_Lookahead;		// StartPipeline()で指定された先読みフレーム数
+	bool				m_bHeadless;
+	z80memaddr_t		m_StartAddr, m_StackAddr;	// Start()で指定されたアドレス
+	int					m_Volume;		// SetMasterVolume()で指定された音量
+	int					m_FadeLoops;	// このループ回数を演奏したらフェードアウトする(0=しない)
+	int					m_FadeVolume;	// フェードアウト中の音量(-1=フェードアウト中ではない)
+	uint32_t			m_FadeStartFrame;
+	double				m_Rate;			// 演奏の速さ（1.0=等倍）
+	double				m_RateAcc;		// 実時間のフレームの端数（等倍より速いときに、書き込みをまとめる間隔を決める）
 
 public:
 	CHopStepZ();
 	virtual ~CHopStepZ();
 public:
-	void Setup();
-	void Run(const z80memaddr_t startAddr, const z80memaddr_t stackAddr, bool *pStop);
+	void Setup(const bool bHeadless = false, const int mapperSegments = 16);
+	void Run(const z80memaddr_t startAddr, const z80memaddr_t stackAddr, const std::atomic<bool> *pStop);
+	void Start(const z80memaddr_t startAddr, const z80memaddr_t stackAddr);
+	bool RunFrame(const std::atomic<bool> *pStop);
+	bool Seek(const uint32_t frame, const std::atomic<bool> *pStop);
+	uint32_t GetFrameCount() const;
+	uint64_t GetInstCount() const;
+	void SetMasterVolume(const int vol, const bool bNow = true);
+	void Mute();
+	void Pause();
+	void Resume();
+	void SetLoopCount(const uint8_t cnt);
+	bool IsSongEnd() const;
+	void SetFadeLoops(const int loops);
+	bool GetLoopInfo(uint32_t *pIntroFrames, uint32_t *pLoopFrames) const;
+	void ResetFrameTiming();
+	void SetPlaybackRate(const double rate);
+	double GetPlaybackRate() const;
+	void SetClockMode(const CMsxClock::MODE mode);
+	void SetVsyncInterrupt(const bool bEnable);
+	void SetTrace(CZ80Trace *pTrace);
+	void Prefault();
+	void FreezeMemory();
+	int ShareMemory(const CHopStepZ &tmpl);
+	void SetStaticDispatch(const bool bStatic);
+	const CFrameScheduler::STATS &GetFrameStats() const;
+	double GetTempoAccuracy() const;
+	uint64_t GetSkippedWrites() const;
+	void PrintProfile() const;
+	void StartPipeline(const int lookahead, const int priority, const int cpu);
+	void StopPipeline();
+
+private:
+	void setVolume(const int vol);
+	bool updateFade();
+	bool runFrame(const std::atomic<bool> *pStop);
+	bool isCoalescing() const;
+	void setChipOutput(const bool bOutput);
+	void resyncChips();
 
 public:
 	void MemoryWrite(const z80memaddr_t addr, const uint8_t b);
@@ -0,0 +1,417 @@
+#include "stdafx.h"
+#include "tools.h"
+#include "msxdef.h"
+#include "CHopStepZ.h"
+#include "CIndexer.h"
+#include <algorithm>
+#include <thread>
+#ifdef __linux
+#include <dirent.h>
+#endif
+
+#ifdef _WIN32
+static const TCHAR PATH_SEP = _T('\\');
+#else
+static const TCHAR PATH_SEP = _T('/');
+#endif
+
+static const uint32_t INDEX_MAGIC	= 0x49535A48;	// "HZSI"
+static const uint16_t INDEX_VERSION	= 2;				// 2: タイトルから先頭の "MGSnnn" の行を除いた
+static const uint32_t MAX_FRAMES	= 60*60*20;		// これ以上演奏が続く曲は測定を打ち切る（約20分）
+
+/** FNV-1a
+ */
+static uint32_t fnv1a(const std::vector<uint8_t> &data)
+{
+	uint32_t h = 2166136261u;
+	for( auto b : data ){
+		h ^= b;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static void putU8(std::vector<uint8_t> *p, const uint8_t v)
+{
+	p->push_back(v);
+	return;
+}
+static void putU16(std::vector<uint8_t> *p, const uint16_t v)
+{
+	putU8(p, static_cast<uint8_t>(v));
+	putU8(p, static_cast<uint8_t>(v>>8));
+	return;
+}
+static void putU32(std::vector<uint8_t> *p, const uint32_t v)
+{
+	putU16(p, static_cast<uint16_t>(v));
+	putU16(p, static_cast<uint16_t>(v>>16));
+	return;
+}
+static void putU64(std::vector<uint8_t> *p, const uint64_t v)
+{
+	putU32(p, static_cast<uint32_t>(v));
+	putU32(p, static_cast<uint32_t>(v>>32));
+	return;
+}
+static void putStr(std::vector<uint8_t> *p, const tstring &str)
+{
+	std::string s;
+	t_ToNarrow(str, &s);
+	const size_t len = std::min<size_t>(s.size(), 0xffff);
+	putU16(p, static_cast<uint16_t>(len));
+	p->insert(p->end(), s.begin(), s.begin()+len);
+	return;
+}
+
+/** インデックスファイルの読み出し（範囲外を読もうとしたら以降はすべて失敗する）
+ */
+class CIndexReader
+{
+private:
+	const std::vector<uint8_t> &m_Data;
+	size_t m_Pos;
+	bool m_bOk;
+public:
+	explicit CIndexReader(const std::vector<uint8_t> &data) : m_Data(data), m_Pos(0), m_bOk(true) { return; }
+	bool IsOk() const { return m_bOk; }
+	uint64_t Get(const int bytes)
+	{
+		if( !m_bOk || m_Data.size() < m_Pos + bytes ){
+			m_bOk = false;
+			return 0;
+		}
+		uint64_t v = 0;
+		for( int t = 0; t < bytes; ++t )
+			v |= static_cast<uint64_t>(m_Data[m_Pos++]) << (t*8);
+		return v;
+	}
+	void GetStr(tstring *pStr)
+	{
+		const size_t len = static_cast<size_t>(Get(2));
+		if( !m_bOk || m_Data.size() < m_Pos + len ){
+			m_bOk = false;
+			return;
+		}
+		std::string s(reinterpret_cast<const char*>(m_Data.data()) + m_Pos, len);
+		m_Pos += len;
+		t_ToWiden(s, pStr);
+		return;
+	}
+};
+
+CIndexer::CIndexer(const std::vector<uint8_t> &driver, const std::vector<uint8_t> &player) :
+	m_Driver(driver), m_Player(player), m_NextIndex(0), m_NumMeasured(0), m_pStop(nullptr)
+{
+	return;
+}
+
+CIndexer::~CIndexer()
+{
+	return;
+}
+
+/** 保存済みのインデックスを読み込む
+ * MGSDRV.COM が異なるインデックスは、演奏時間が変わりうるので使わない。
+ */
+bool CIndexer::Load(const tstring &indexPath)
+{
+	m_OldEntries.clear();
+	std::vector<uint8_t> *pData = nullptr;
+	if( !t_ReadFile(indexPath, &pData) ){
+		NULL_DELETE(pData);
+		return false;
+	}
+	CIndexReader rd(*pData);
+	bool bRet =
+		rd.Get(4) == INDEX_MAGIC &&
+		rd.Get(2) == INDEX_VERSION &&
+		rd.Get(4) == fnv1a(m_Driver);
+	const size_t num = static_cast<size_t>(rd.Get(4));
+	for( size_t t = 0; bRet && t < num; ++t ){
+		HSZINDEXENTRY e;
+		rd.GetStr(&e.Path);
+		e.MTime = static_cast<int64_t>(rd.Get(8));
+		e.Hash = static_cast<uint32_t>(rd.Get(4));
+		e.IntroFrames = static_cast<uint32_t>(rd.Get(4));
+		e.LoopFrames = static_cast<uint32_t>(rd.Get(4));
+		e.Status = static_cast<HSZINDEXENTRY::STATUS>(rd.Get(1));
+		rd.GetStr(&e.Title);
+		bRet = rd.IsOk();
+		if( bRet )
+			m_OldEntries[e.Path] = e;
+	}
+	if( !bRet )
+		m_OldEntries.clear();
+	NULL_DELETE(pData);
+	return bRet;
+}
+
+bool CIndexer::Save(const tstring &indexPath) const
+{
+	std::vector<uint8_t> data;
+	putU32(&data, INDEX_MAGIC);
+	putU16(&data, INDEX_VERSION);
+	putU32(&data, fnv1a(m_Driver));
+	const size_t numPos = data.size();
+	putU32(&data, 0);
+	uint32_t num = 0;
+	for( auto &e : m_Entries ){
+		if( e.Status == HSZINDEXENTRY::STATUS_PENDING )
+			continue;
+		putStr(&data, e.Path);
+		putU64(&data, static_cast<uint64_t>(e.MTime));
+		putU32(&data, e.Hash);
+		putU32(&data, e.IntroFrames);
+		putU32(&data, e.LoopFrames);
+		putU8(&data, static_cast<uint8_t>(e.Status));
+		putStr(&data, e.Title);
+		++num;
+	}
+	for( int t = 0; t < 4; ++t )
+		data[numPos+t] = static_cast<uint8_t>(num >> (t*8));
+	return t_WriteFile(indexPath, data);
+}
+
+/** ディレクトリ以下の *.mgs を再帰的に探して、インデックスの対象にする
+ */
+bool CIndexer::AddDirectory(const tstring &dirPath)
+{
+	std::vector<tstring> names;
+#ifdef __linux
+	std::string path;
+	t_ToNarrow(dirPath, &path);
+	DIR *pDir = ::opendir(path.c_str());
+	if( pDir == nullptr )
+		return false;
+	for(struct dirent *pEnt = ::readdir(pDir); pEnt != nullptr; pEnt = ::readdir(pDir)){
+		if( strcmp(pEnt->d_name, ".") == 0 || strcmp(pEnt->d_name, "..") == 0 )
+			continue;
+		tstring name;
+		t_ToWiden(pEnt->d_name, &name);
+		names.push_back(name);
+	}
+	::closedir(pDir);
+#endif
+#ifdef _WIN32
+	WIN32_FIND_DATA fd;
+	HANDLE hFind = ::FindFirstFile((dirPath + PATH_SEP + _T("*")).c_str(), &fd);
+	if( hFind == INVALID_HANDLE_VALUE )
+		return false;
+	do {
+		const tstring name(fd.cFileName);
+		if( name != _T(".") && name != _T("..") )
+			names.push_back(name);
+	} while( ::FindNextFile(hFind, &fd) );
+	::FindClose(hFind);
+#endif
+	std::sort(names.begin(), names.end());
+	tstring base = dirPath;
+	if( !base.empty() && base[base.size()-1] != PATH_SEP )
+		base += PATH_SEP;
+	for( auto &name : names ){
+		const tstring path = base + name;
+		if( t_IsDirectory(path) )
+			AddDirectory(path);
+		else if( t_HasExtension(name, _T(".mgs")) )
+			m_Files.push_back(path);
+	}
+	return true;
+}
+
+/** 全ファイルの情報を、CPUのコア数分のスレッドで並列に更新する
+ * @param pStop 途中で止める場合に true になる（止めた時点で未処理のファイルはインデックスから外す）
+ */
+void CIndexer::Update(const std::atomic<bool> *pStop)
+{
+	m_Entries.clear();
+	m_Entries.resize(m_Files.size());
+	for( size_t t = 0; t < m_Files.size(); ++t )
+		m_Entries[t].Path = m_Files[t];
+	m_NextIndex = 0;
+	m_NumMeasured = 0;
+	m_pStop = pStop;
+
+	// MGSDRVを常駐させた直後のメモリを、各スレッドのMSXから共有させる
+	CHopStepZ *pTemplate = GCC_NEW CHopStepZ();
+	pTemplate->Setup(true);
+	pTemplate->MemoryWrite(0x0100, m_Driver);
+	pTemplate->Run(0x0100, 0xD400, m_pStop);
+	pTemplate->FreezeMemory();
+
+	const size_t numThreads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), m_Files.size()));
+	std::vector<std::thread> threads;
+	for( size_t t = 0; t < numThreads; ++t )
+		threads.push_back(std::thread(&CIndexer::workerThread, this, pTemplate));
+	for( auto &th : threads )
+		th.join();
+	NULL_DELETE(pTemplate);
+
+	m_Entries.erase(
+		std::remove_if(m_Entries.begin(), m_Entries.end(),
+			[](const HSZINDEXENTRY &e){ return e.Status == HSZINDEXENTRY::STATUS_PENDING; }),
+		m_Entries.end());
+	m_pStop = nullptr;
+	return;
+}
+
+const std::vector<HSZINDEXENTRY> &CIndexer::GetEntries() const
+{
+	return m_Entries;
+}
+
+/** 直前の Update() で、実際に演奏して測り直した曲の数
+ */
+size_t CIndexer::GetNumMeasured() const
+{
+	return m_NumMeasured;
+}
+
+/** MGSファイル先頭のタイトル文字列(SJIS)を得る
+ * 先頭は "MGSnnn" CR LF で、その後ろから CR LF EOF までがタイトル
+ */
+void CIndexer::GetTitle(tstring *pTitle, const std::vector<uint8_t> &mgs)
+{
+	pTitle->clear();
+	if( mgs.size() < 3 || memcmp(mgs.data(), "MGS", 3) != 0 )
+		return;
+	auto *pMs = reinterpret_cast<const char*>(mgs.data());
+	const size_t ssz = strnlen(pMs, mgs.size());
+	size_t top = 0;
+	for( size_t t = 0; t + 1 < ssz; ++t ){
+		if( pMs[t] == '\r' && pMs[t+1] == '\n' ){
+			top = t + 2;
+			break;
+		}
+	}
+	size_t end = top;
+	while( end < ssz && pMs[end] != '\r' && pMs[end] != '\n' && pMs[end] != 0x1A )
+		++end;
+	t_FromSjis(pTitle, pMs + top, end - top);
+	return;
+}
+
+/** スレッドごとにヘッドレスのMSXを１台用意し、MGSDRVを常駐させてから曲を順に取り出して処理する
+ * CPUや音源の状態は複製できないので、常駐はスレッドごとに行い、その後でメモリを pTemplate と共有する。
+ */
+void CIndexer::workerThread(const CHopStepZ *pTemplate)
+{
+	CHopStepZ *pMsx = GCC_NEW CHopStepZ();
+	pMsx->Setup(true);
+	pMsx->MemoryWrite(0x0100, m_Driver);
+	pMsx->Run(0x0100, 0xD400, m_pStop);
+	pMsx->ShareMemory(*pTemplate);
+
+	for(;;){
+		if( isStopRequested() )
+			break;
+		const size_t index = m_NextIndex++;
+		if( m_Entries.size() <= index )
+			break;
+		updateEntry(pMsx, &m_Entries[index]);
+	}
+	NULL_DELETE(pMsx);
+	return;
+}
+
+/** 更新時刻かハッシュ値が前回と同じなら前回の結果を使い、そうでなければ演奏して測る
+ */
+void CIndexer::updateEntry(CHopStepZ *pMsx, HSZINDEXENTRY *pEntry)
+{
+	const int64_t mtime = t_GetFileMTime(pEntry->Path);
+	auto it = m_OldEntries.find(pEntry->Path);
+	const HSZINDEXENTRY *pOld = (it != m_OldEntries.end()) ? &it->second : nullptr;
+	if( pOld != nullptr && pOld->MTime == mtime && mtime != 0 ){
+		*pEntry = *pOld;
+		return;
+	}
+
+	std::vector<uint8_t> *pMgs = nullptr;
+	if( !t_ReadFile(pEntry->Path, &pMgs) ){
+		pEntry->MTime = mtime;
+		pEntry->Status = HSZINDEXENTRY::STATUS_LOAD_ERROR;
+		NULL_DELETE(pMgs);
+		return;
+	}
+	const uint32_t hash = fnv1a(*pMgs);
+	if( pOld != nullptr && pOld->Hash == hash ){
+		*pEntry = *pOld;
+		pEntry->MTime = mtime;
+	}
+	else{
+		pEntry->MTime = mtime;
+		pEntry->Hash = hash;
+		GetTitle(&pEntry->Title, *pMgs);
+		measure(pMsx, *pMgs, pEntry);
+	}
+	NULL_DELETE(pMgs);
+	return;
+}
+
+/** ループ回数を無限にして演奏し、ループを検出した時点でイントロと１ループの長さが決まる。
+ * 検出できない場合は、ループ回数を 1回と 2回にして演奏し、その差から求める。
+ */
+void CIndexer::measure(CHopStepZ *pMsx, const std::vector<uint8_t> &mgs, HSZINDEXENTRY *pEntry)
+{
+	bool bEnd;
+	const uint32_t frames = runSong(pMsx, mgs, 0xff, true, &bEnd);
+	if( isStopRequested() )
+		return;
+	if( bEnd || pMsx->GetLoopInfo(&pEntry->IntroFrames, &pEntry->LoopFrames) ){
+		if( bEnd ){
+			// ループしない曲
+			pEntry->IntroFrames = frames;
+			pEntry->LoopFrames = 0;
+		}
+		pEntry->Status = HSZINDEXENTRY::STATUS_OK;
+		++m_NumMeasured;
+		return;
+	}
+
+	bool bEnd1, bEnd2;
+	const uint32_t frames1 = runSong(pMsx, mgs, 1, false, &bEnd1);
+	if( isStopRequested() )
+		return;
+	if( !bEnd1 ){
+		pEntry->IntroFrames = frames1;
+		pEntry->LoopFrames = 0;
+		pEntry->Status = HSZINDEXENTRY::STATUS_TIMEOUT;
+		++m_NumMeasured;
+		return;
+	}
+	const uint32_t frames2 = runSong(pMsx, mgs, 2, false, &bEnd2);
+	if( isStopRequested() )
+		return;
+	const uint32_t loop = (bEnd2 && frames1 < frames2) ? (frames2 - frames1) : 0;
+	pEntry->IntroFrames = (loop < frames1) ? (frames1 - loop) : frames1;
+	pEntry->LoopFrames = loop;
+	pEntry->Status = HSZINDEXENTRY::STATUS_OK;
+	++m_NumMeasured;
+	return;
+}
+
+/** 曲を最後まで（最大 MAX_FRAMES）ヘッドレスで演奏する
+ * @param bUntilLoop true ならループを検出した時点で打ち切る
+ * @param pbEnd 曲が終わったら true、打ち切ったら false
+ * @return 演奏したフレーム数
+ */
+uint32_t CIndexer::runSong(
+	CHopStepZ *pMsx, const std::vector<uint8_t> &mgs, const uint8_t loops, const bool bUntilLoop, bool *pbEnd)
+{
+	uint32_t intro, loop;
+	pMsx->SetLoopCount(loops);
+	pMsx->MemoryWrite(0x8000, mgs);
+	pMsx->MemoryWrite(0x0100, m_Player);
+	pMsx->Start(0x0100, 0xD400);
+	while( pMsx->GetFrameCount() < MAX_FRAMES && pMsx->RunFrame(m_pStop) ){
+		if( bUntilLoop && pMsx->GetLoopInfo(&intro, &loop) )
+			break;
+	}
+	*pbEnd = pMsx->IsSongEnd();
+	return pMsx->GetFrameCount();
+}
+
+bool CIndexer::isStopRequested() const
+{
+	return m_pStop != nullptr && *m_pStop;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+#include <map>
+#include <vector>
+
+class CHopStepZ;
+
+/** インデックスの１曲分の情報
+ */
+struct HSZINDEXENTRY
+{
+	enum STATUS { STATUS_OK, STATUS_LOAD_ERROR, STATUS_TIMEOUT, STATUS_PENDING };
+	tstring		Path;
+	int64_t		MTime;
+	uint32_t	Hash;			// ファイル内容のハッシュ値
+	tstring		Title;
+	uint32_t	IntroFrames;	// ループ開始までのフレーム数
+	uint32_t	LoopFrames;		// １ループのフレーム数（0=ループしない曲）
+	STATUS		Status;
+	HSZINDEXENTRY() : MTime(0), Hash(0), IntroFrames(0), LoopFrames(0), Status(STATUS_PENDING) { return; }
+};
+
+/** MGSファイルのライブラリのインデックス（タイトルと演奏時間）を作る
+ * ディレクトリを再帰的に探して、見つけたファイルを全コアで並列にヘッドレス実行して演奏時間を測る。
+ * 結果はファイルに保存しておき、更新時刻とハッシュ値が変わっていないファイルは測り直さない。
+ */
+class CIndexer
+{
+private:
+	const std::vector<uint8_t> &m_Driver;
+	const std::vector<uint8_t> &m_Player;
+	std::vector<HSZINDEXENTRY> m_Entries;		// Update()後の内容
+	std::map<tstring, HSZINDEXENTRY> m_OldEntries;	// Load()で読み込んだ内容
+	std::vector<tstring> m_Files;
+	std::atomic<size_t> m_NextIndex;
+	std::atomic<size_t> m_NumMeasured;
+	const std::atomic<bool> *m_pStop;
+
+public:
+	CIndexer(const std::vector<uint8_t> &driver, const std::vector<uint8_t> &player);
+	virtual ~CIndexer();
+
+public:
+	bool Load(const tstring &indexPath);
+	bool Save(const tstring &indexPath) const;
+	bool AddDirectory(const tstring &dirPath);
+	void Update(const std::atomic<bool> *pStop);
+	const std::vector<HSZINDEXENTRY> &GetEntries() const;
+	size_t GetNumMeasured() const;
+	static void GetTitle(tstring *pTitle, const std::vector<uint8_t> &mgs);
+
+private:
+	void workerThread(const CHopStepZ *pTemplate);
+	void updateEntry(CHopStepZ *pMsx, HSZINDEXENTRY *pEntry);
+	void measure(CHopStepZ *pMsx, const std::vector<uint8_t> &mgs, HSZINDEXENTRY *pEntry);
+	uint32_t runSong(
+		CHopStepZ *pMsx, const std::vector<uint8_t> &mgs, const uint8_t loops, const bool bUntilLoop, bool *pbEnd);
+	bool isStopRequested() const;
+};
@@ -0,0 +1,73 @@
+#include "stdafx.h"
+#include "CLoopDetector.h"
+
+CLoopDetector::CLoopDetector()
+{
+	m_Hash = 0;
+	m_IgnoreKey = 0xffffffff;
+	Reset();
+	return;
+}
+
+CLoopDetector::~CLoopDetector()
+{
+	// do nothing
+	return;
+}
+
+/** 曲の演奏開始時に呼ぶ。記録したフレームと検出結果を消す
+ * （ハッシュ値はその時点の状態を表しているので、そのまま残す）
+ */
+void CLoopDetector::Reset()
+{
+	m_History.clear();
+	m_bDetected = false;
+	m_IntroFrames = 0;
+	m_LoopFrames = 0;
+	return;
+}
+
+/** ハッシュに含めない key（ループ回数のカウンタなど）
+ */
+void CLoopDetector::SetIgnoreKey(const uint32_t key)
+{
+	m_IgnoreKey = key;
+	return;
+}
+
+/** MGS_INTER を１回呼ぶごとに呼ぶ
+ */
+void CLoopDetector::Frame(const uint32_t frameNo)
+{
+	if( m_bDetected )
+		return;
+	auto it = m_History.find(m_Hash);
+	if( it != m_History.end() ){
+		m_bDetected = true;
+		m_IntroFrames = it->second;
+		m_LoopFrames = frameNo - it->second;
+		m_History.clear();
+		return;
+	}
+	m_History[m_Hash] = frameNo;
+	return;
+}
+
+bool CLoopDetector::IsDetected() const
+{
+	return m_bDetected;
+}
+
+/** ループの始点までのフレーム数
+ */
+uint32_t CLoopDetector::GetIntroFrames() const
+{
+	return m_IntroFrames;
+}
+
+/** １ループのフレーム数
+ */
+uint32_t CLoopDetector::GetLoopFrames() const
+{
+	return m_LoopFrames;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include <unordered_map>
+
+/** 曲のループ点の検出
+ * MGSDRVのワーク（ページ1のRAM）と音源チップのレジスタの内容から求めたハッシュ値を
+ * MGS_INTER の呼び出しごとに記録し、同じ値が最初に現れた２つのフレームをループの始点と終点とする。
+ * ハッシュ値は、書き込みのたびに変化した分だけを XOR で差し替えて更新する（Zobrist hashing）。
+ */
+class CLoopDetector
+{
+public:
+	// Update() の key に使う値
+	static const uint32_t KEY_MEMORY	= 0x00000;	// +CPUのアドレス
+	static const uint32_t KEY_OPLL		= 0x10000;	// +レジスタ番号
+	static const uint32_t KEY_PSG		= 0x10100;	// +レジスタ番号
+	static const uint32_t KEY_SCC		= 0x10200;	// +0x9800からのオフセット
+
+private:
+	uint64_t m_Hash;
+	uint32_t m_IgnoreKey;
+	std::unordered_map<uint64_t, uint32_t> m_History;	// ハッシュ値 -> フレーム番号
+	bool m_bDetected;
+	uint32_t m_IntroFrames;
+	uint32_t m_LoopFrames;
+
+public:
+	CLoopDetector();
+	virtual ~CLoopDetector();
+
+public:
+	void Reset();
+	void SetIgnoreKey(const uint32_t key);
+	void Frame(const uint32_t frameNo);
+	bool IsDetected() const;
+	uint32_t GetIntroFrames() const;
+	uint32_t GetLoopFrames() const;
+
+	/** key の値が oldV から newV に変わったことを反映する */
+	void Update(const uint32_t key, const uint8_t oldV, const uint8_t newV)
+	{
+		if( oldV == newV || key == m_IgnoreKey )
+			return;
+		m_Hash ^= zobrist(key, oldV) ^ zobrist(key, newV);
+		return;
+	}
+
+private:
+	/** (key,値)の組ごとの乱数（splitmix64） */
+	static uint64_t zobrist(const uint32_t key, const uint8_t v)
+	{
+		uint64_t z = ((static_cast<uint64_t>(key) << 8) | v) + 0x9E3779B97F4A7C15ull;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+};
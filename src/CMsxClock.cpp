@@ -0,0 +1,62 @@
+﻿#include "stdafx.h"
+#include "CMsxClock.h"
+
+CMsxClock::CMsxClock()
+{
+	m_Mode = MODE_REALTIME;
+	m_TStates = 0;
+	m_FrameBegin = 0;
+	m_Offset = 0;
+	m_RealTime.ResetBegin();
+	return;
+}
+
+CMsxClock::~CMsxClock()
+{
+	// do nothing
+	return;
+}
+
+/** 途中で切り替えても、GetMicroseconds() は切り替えた時点の値から続けて進む
+ */
+void CMsxClock::SetMode(const MODE mode)
+{
+	const uint64_t now = GetMicroseconds();
+	m_Mode = mode;
+	m_Offset = 0;
+	m_Offset = now - GetMicroseconds();
+	return;
+}
+
+CMsxClock::MODE CMsxClock::GetMode() const
+{
+	return m_Mode;
+}
+
+/** 時刻[us]（起点は任意なので、差分だけを使うこと）
+ */
+uint64_t CMsxClock::GetMicroseconds()
+{
+	if( m_Mode == MODE_VIRTUAL )
+		return m_TStates * 1000000 / CPU_CLOCK_HZ + m_Offset;
+	return m_RealTime.GetTime() + m_Offset;
+}
+
+/** 仮想時刻で、GetMicroseconds() が us 以上になる最初のTステート数
+ */
+uint64_t CMsxClock::MicrosecondsToTStates(const uint64_t us) const
+{
+	assert(m_Mode == MODE_VIRTUAL);
+	return ((us - m_Offset) * CPU_CLOCK_HZ + 1000000 - 1) / 1000000;
+}
+
+/** フレームの終わり（WT16MS）
+ * 仮想時刻では、WT16MS で待っている間も Z80 が動き続けていたとして、次のフレームの開始まで時刻を進める
+ */
+void CMsxClock::EndFrame()
+{
+	if( m_Mode == MODE_VIRTUAL && m_TStates < m_FrameBegin + FRAME_TSTATES )
+		m_TStates = m_FrameBegin + FRAME_TSTATES;
+	m_FrameBegin = m_TStates;
+	return;
+}
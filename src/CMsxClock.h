@@ -0,0 +1,44 @@
+#pragma once
+#include "stdafx.h"
+#include "CUTimeCount.h"
+
+/** エミュレータ内の時刻の元（システムタイマー E6h/E7h、割り込みのタイミング）
+ * REALTIME : 実時間（従来どおり）
+ * VIRTUAL  : Z80が実行したTステート数から求める。実行のたびに同じ結果になり、時刻の取得にシステムコールを使わない
+ */
+class CMsxClock
+{
+public:
+	enum MODE { MODE_REALTIME, MODE_VIRTUAL };
+	static const uint32_t CPU_CLOCK_HZ = 3579545;	// Z80 3.579545MHz
+	static const uint32_t FRAME_TSTATES = 59736;	// 1フレーム(VSYNC 59.94Hz)のTステート数
+
+private:
+	MODE			m_Mode;
+	uint64_t		m_TStates;		// 実行したTステート数
+	uint64_t		m_FrameBegin;	// 現在のフレームの開始時のTステート数
+	uint64_t		m_Offset;		// [us] モードを切り替えても時刻が連続するように足す値
+	CUTimeCount		m_RealTime;
+
+public:
+	CMsxClock();
+	virtual ~CMsxClock();
+
+public:
+	void SetMode(const MODE mode);
+	MODE GetMode() const;
+	uint64_t GetMicroseconds();
+	uint64_t MicrosecondsToTStates(const uint64_t us) const;
+	void EndFrame();
+
+	/** Z80の実行したTステート数を足す */
+	void AddTStates(const uint32_t n)
+	{
+		m_TStates += n;
+		return;
+	}
+	uint64_t GetTStates() const
+	{
+		return m_TStates;
+	}
+};
@@ -1,50 +1,69 @@
 ﻿#include "stdafx.h"
 #include "msxdef.h"
 #include "CMsxIoSystem.h"
+#include "CMsxClock.h"
 #include <assert.h>
 #include <vector>
 
 CMsxIoSystem::CMsxIoSystem()
 {
-	m_SystemTimer.ResetBegin();
+	m_pClock = nullptr;
+	m_SystemTimerBase = 0;
 	m_SystemTimeCount = 0;
+	for( int t = 0; t < NUM_PORTS; ++t ){
+		m_Ports[t] = nullptr;
+		m_UnclaimedOut[t] = m_UnclaimedIn[t] = 0;
+	}
 	return;
 }
 
 CMsxIoSystem::~CMsxIoSystem()
 {
-	// do nothing
+#if !defined(NDEBUG)
+	PrintUnclaimedPorts();
+#endif
 	return;
 
 }
+
+/** 装置を加えて、その装置が受け持つポートの呼び出し先にする
+ */
 void CMsxIoSystem::JoinObject(IZ80IoDevice *pIoObj)
 {
 	assert(pIoObj != nullptr);
-	m_Objs.push_back(pIoObj);
+	for( int t = 0; t < NUM_PORTS; ++t ){
+		if( !pIoObj->HasPort(static_cast<z80ioaddr_t>(t)) )
+			continue;
+		assert(m_Ports[t] == nullptr);	// 一つのポートを受け持つのは一つの装置だけ
+		m_Ports[t] = pIoObj;
+	}
 	return;
 }
-void CMsxIoSystem::Out(const z80ioaddr_t addr, const uint8_t b)
+
+/** どの装置も受け持たないポートへのアクセスを、回数とともに表示する（デバッグ用）
+ */
+void CMsxIoSystem::PrintUnclaimedPorts() const
 {
-	for( auto &p : m_Objs )
-		p->OutPort(addr, b);
+	for( int t = 0; t < NUM_PORTS; ++t ){
+		if( m_UnclaimedOut[t] != 0 || m_UnclaimedIn[t] != 0 )
+			::wprintf(_T("UNCLAIMED PORT: %02Xh, out %u, in %u\n"), t, m_UnclaimedOut[t], m_UnclaimedIn[t]);
+	}
 	return;
 }
 
-uint8_t CMsxIoSystem::In(const z80ioaddr_t addr)
+/** システムタイマー(E6h/E7h)の時刻の元
+ */
+void CMsxIoSystem::SetClock(CMsxClock *pClock)
 {
-	uint8_t b = 0xFF;
-	for( auto &p : m_Objs ){
-		if( p->InPort(&b, addr) )
-			break;
-	}
-	return b;
+	m_pClock = pClock;
+	m_SystemTimerBase = m_pClock->GetMicroseconds();
+	return;
 }
-
 bool CMsxIoSystem::OutPort(const z80ioaddr_t addr, const uint8_t b)
 {
 	if (addr == 0xe6) {
 		m_SystemTimeCount = 0;
-		m_SystemTimer.ResetBegin();
+		m_SystemTimerBase = m_pClock->GetMicroseconds();
 		return true;
 	}
 	return false;
@@ -64,12 +83,38 @@ bool CMsxIoSystem::InPort(uint8_t *pB, const z80ioaddr_t addr)
 	}
 	return false;
 }
+
+bool CMsxIoSystem::HasPort(const z80ioaddr_t addr) const
+{
+	return addr == 0xe6 || addr == 0xe7;
+}
+
 void CMsxIoSystem::updateSystemTimer()
 {
-	uint64_t temp = m_SystemTimer.GetTime();
+	assert(m_pClock != nullptr);
+	const uint64_t now = m_pClock->GetMicroseconds();
+	uint64_t temp = now - m_SystemTimerBase;
 	if( 4 <= temp ){
+		// 端数は次に持ち越す（読む間隔によってタイマーの進み方が変わらないように）
 		m_SystemTimeCount += static_cast<uint16_t>(temp / 4);		// 4は本来は3.911us
-		m_SystemTimer.ResetBegin();
+		m_SystemTimerBase += temp / 4 * 4;
 	}
 	return;
 }
+
+/** システムタイマーの今の値
+ */
+uint16_t CMsxIoSystem::GetSystemTimer()
+{
+	updateSystemTimer();
+	return m_SystemTimeCount;
+}
+
+/** システムタイマーが count になる時刻[us]（今の値から先へ数えて、最初に count になる時刻）
+ */
+uint64_t CMsxIoSystem::GetSystemTimerTime(const uint16_t count)
+{
+	updateSystemTimer();
+	const uint16_t ticks = static_cast<uint16_t>(count - m_SystemTimeCount);
+	return m_SystemTimerBase + static_cast<uint64_t>(ticks) * 4;
+}
@@ -1,28 +1,59 @@
 #pragma once
 #include "msxdef.h"
 #include <vector>
-#include "CUTimeCount.h"
 
+class CMsxClock;
+
+/** I/Oポート
+ * 各装置が HasPort() で受け持つと答えたポートを JoinObject() の時点で表にしておき、
+ * IN/OUT はポート番号で引いた装置だけを呼び出す。
+ */
 class CMsxIoSystem : public IZ80IoDevice
 {
 private:
-	std::vector<IZ80IoDevice*> m_Objs;
-	CUTimeCount m_SystemTimer;
+	static const int NUM_PORTS = 256;
+	IZ80IoDevice *m_Ports[NUM_PORTS];		// ポートを受け持つ装置（nullptr=どの装置も受け持たない）
+	uint32_t	m_UnclaimedOut[NUM_PORTS];	// どの装置も受け持たないポートへのアクセス回数
+	uint32_t	m_UnclaimedIn[NUM_PORTS];
+	CMsxClock	*m_pClock;
+	uint64_t	m_SystemTimerBase;		// [us] 最後に m_SystemTimeCount を進めた時刻
 	uint16_t	m_SystemTimeCount;
 
 public:
 	CMsxIoSystem();
 	virtual ~CMsxIoSystem();
 	void JoinObject(IZ80IoDevice *pIoObj);
+	void SetClock(CMsxClock *pClock);
+	uint16_t GetSystemTimer();
+	uint64_t GetSystemTimerTime(const uint16_t count);
 
 public:
-	void Out(const z80ioaddr_t addr, const uint8_t b);
-	uint8_t In(const z80ioaddr_t addr);
+	void Out(const z80ioaddr_t addr, const uint8_t b)
+	{
+		IZ80IoDevice *p = m_Ports[addr];
+		if( p != nullptr )
+			p->OutPort(addr, b);
+		else
+			++m_UnclaimedOut[addr];
+		return;
+	}
+	uint8_t In(const z80ioaddr_t addr)
+	{
+		uint8_t b = 0xFF;
+		IZ80IoDevice *p = m_Ports[addr];
+		if( p != nullptr )
+			p->InPort(&b, addr);
+		else
+			++m_UnclaimedIn[addr];
+		return b;
+	}
+	void PrintUnclaimedPorts() const;
 
 public:
 /*IZ80IoDevice*/
 	bool OutPort(const z80ioaddr_t addr, const uint8_t b);
 	bool InPort(uint8_t *pB, const z80ioaddr_t addr);
+	bool HasPort(const z80ioaddr_t addr) const;
 
 private:
 	void updateSystemTimer();
@@ -1,8 +1,10 @@
 ﻿#include "stdafx.h"
 #include "msxdef.h"
 #include <vector>
+#include <algorithm>
 #include <assert.h>
 #include "CMsxMemSlotSystem.h"
+#include "CLoopDetector.h"
 
 CMsxMemSlotSystem::CMsxMemSlotSystem()
 {
@@ -10,12 +12,17 @@ CMsxMemSlotSystem::CMsxMemSlotSystem()
 	for( int x = 0; x < SLOTNO_NUM; ++x){
 		for( int y = 0; y < SLOTNO_NUM; ++y){
 			m_MemObjs[x][y] = &m_VoidMem;
+			m_MemTypes[x][y] = DEVTYPE_VOID;
 		}
 	}
 
 	// Z80面り空間の全ページはスロット3-0にしておく
 	for( int t = 0; t < MEMPAGENO_NUM; ++t)
 		m_SlotNoToPage[t] = PAGEBIND(SLOTNO_3, SLOTNO_0);
+	m_pLoopDetector = nullptr;
+	m_WatchBegin = m_WatchEnd = 0;
+	m_bStaticDispatch = true;
+	updatePages();
 	return;
 }
 
@@ -25,13 +32,70 @@ CMsxMemSlotSystem::~CMsxMemSlotSystem()
 	return;
 }
 
+void CMsxMemSlotSystem::JoinObject(
+	const SLOTNO baseSlotNo, const SLOTNO extSlotNo, CMsxMemoryMapper *pObj)
+{
+	joinObject(baseSlotNo, extSlotNo, pObj, DEVTYPE_RAM);
+	return;
+}
+
+void CMsxMemSlotSystem::JoinObject(
+	const SLOTNO baseSlotNo, const SLOTNO extSlotNo, CScc *pObj)
+{
+	joinObject(baseSlotNo, extSlotNo, pObj, DEVTYPE_SCC);
+	return;
+}
+
+/** 型の分からない装置は、仮想関数で呼び出す
+ */
 void CMsxMemSlotSystem::JoinObject(
 	const SLOTNO baseSlotNo, const SLOTNO extSlotNo, IZ80MemoryDevice *pObj)
+{
+	joinObject(baseSlotNo, extSlotNo, pObj, DEVTYPE_OTHER);
+	return;
+}
+
+void CMsxMemSlotSystem::joinObject(
+	const SLOTNO baseSlotNo, const SLOTNO extSlotNo, IZ80MemoryDevice *pObj, const DEVTYPE type)
 {
 	assert(SLOTNO_0 <= baseSlotNo && baseSlotNo <= SLOTNO_3);
 	assert(SLOTNO_0 <= extSlotNo && extSlotNo <= SLOTNO_3);
 	assert(pObj != nullptr);
 	m_MemObjs[baseSlotNo][extSlotNo] = pObj;
+	m_MemTypes[baseSlotNo][extSlotNo] = type;
+	updatePages();
+	return;
+}
+
+/** 型の分かっている装置を仮想関数を通さずに呼び出すかどうか（false は速さの比較用）
+ */
+void CMsxMemSlotSystem::SetStaticDispatch(const bool bStatic)
+{
+	m_bStaticDispatch = bStatic;
+	updatePages();
+	return;
+}
+
+/** 各ページに見えている装置を求め直す
+ */
+void CMsxMemSlotSystem::updatePages()
+{
+	for( int t = 0; t < MEMPAGENO_NUM; ++t ){
+		const auto &slot = m_SlotNoToPage[t];
+		m_PageDev[t].pObj = m_MemObjs[slot.BaseNo][slot.ExtNo];
+		m_PageDev[t].Type = m_bStaticDispatch ? m_MemTypes[slot.BaseNo][slot.ExtNo] : DEVTYPE_OTHER;
+	}
+	return;
+}
+
+/** begin～end のアドレスへの書き込みを、ループ検出のハッシュに反映する
+ */
+void CMsxMemSlotSystem::SetLoopDetector(
+	CLoopDetector *pDetector, const z80memaddr_t begin, const z80memaddr_t end)
+{
+	m_pLoopDetector = pDetector;
+	m_WatchBegin = begin;
+	m_WatchEnd = end;
 	return;
 }
 
@@ -44,6 +108,7 @@ void CMsxMemSlotSystem::ChangeSlot(
 	assert(SLOTNO_0 <= baseSlotNo && baseSlotNo <= SLOTNO_3);
 	assert(SLOTNO_0 <= extSlotNo && extSlotNo <= SLOTNO_3);
 	m_SlotNoToPage[pageNo] = PAGEBIND(baseSlotNo, extSlotNo);
+	updatePages();
 	return;
 }
 
@@ -59,37 +124,164 @@ void CMsxMemSlotSystem::GetSlot(
 	return;
 }
 
-/** 指定メモリにバイナリデータを書き込む
+/** 指定メモリにバイナリデータを書き込む（FFFFh もループ検出も考えず、そのまま装置に書き込む）
  */
 void CMsxMemSlotSystem::BinaryTo(
 	const z80memaddr_t dest, const std::vector<uint8_t> &block)
 {
-	z80memaddr_t p = dest;
-	for(auto b : block){
-		writeByte(p++, b);
+	z80memaddr_t ad = dest;
+	const uint8_t *pSrc = block.data();
+	size_t rest = block.size();
+	while( 0 < rest ){
+		const size_t n = std::min(rest, pageRest(ad));
+		m_PageDev[ad / Z80_PAGE_SIZE].pObj->WriteBlock(ad, pSrc, n);
+		ad = static_cast<z80memaddr_t>(ad + n), pSrc += n, rest -= n;
 	}
 	return;
 }
 
-void CMsxMemSlotSystem::writeByte(const z80memaddr_t addr, const uint8_t b)
+/** addr からページの終わりまでのバイト数
+ */
+size_t CMsxMemSlotSystem::pageRest(const z80memaddr_t addr)
+{
+	return Z80_PAGE_SIZE - addr % Z80_PAGE_SIZE;
+}
+
+/** Write() で特別に扱う（FFFFh か、ループ検出で見ている）アドレスを含むか
+ */
+bool CMsxMemSlotSystem::isSpecialWrite(const z80memaddr_t addr, const size_t size) const
 {
-	auto pageNo = addr / Z80_PAGE_SIZE;
-	auto slot = m_SlotNoToPage[pageNo];
-	auto *p = m_MemObjs[slot.BaseNo][slot.ExtNo];
-	p->WriteMem(addr, b);
+	const size_t last = addr + size - 1;
+	if( 0xffff <= last )
+		return true;
+	return m_pLoopDetector != nullptr && addr <= m_WatchEnd && m_WatchBegin <= last;
+}
+
+/** Write() を addr から size バイト分行ったのと同じ結果になるように書き込む
+ * ページの中で特別に扱うアドレスを含まない部分は、装置にまとめて書き込む。
+ */
+void CMsxMemSlotSystem::WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size)
+{
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const size_t n = std::min(rest, pageRest(ad));
+		if( isSpecialWrite(ad, n) ){
+			for( size_t t = 0; t < n; ++t )
+				Write(static_cast<z80memaddr_t>(ad + t), pSrc[t]);
+		}
+		else{
+			m_PageDev[ad / Z80_PAGE_SIZE].pObj->WriteBlock(ad, pSrc, n);
+		}
+		ad = static_cast<z80memaddr_t>(ad + n), pSrc += n, rest -= n;
+	}
 	return;
 }
 
-uint8_t CMsxMemSlotSystem::readByte(const z80memaddr_t addr) const
+void CMsxMemSlotSystem::FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size)
 {
-	auto pageNo = addr / Z80_PAGE_SIZE;
-	auto slot = m_SlotNoToPage[pageNo];
-	auto *p = m_MemObjs[slot.BaseNo][slot.ExtNo];
-	uint8_t b = p->ReadMem(addr);
-	return b;
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const size_t n = std::min(rest, pageRest(ad));
+		if( isSpecialWrite(ad, n) ){
+			for( size_t t = 0; t < n; ++t )
+				Write(static_cast<z80memaddr_t>(ad + t), b);
+		}
+		else{
+			m_PageDev[ad / Z80_PAGE_SIZE].pObj->FillBlock(ad, b, n);
+		}
+		ad = static_cast<z80memaddr_t>(ad + n), rest -= n;
+	}
+	return;
+}
+
+/** Read() を addr から size バイト分行ったのと同じ結果を読み込む
+ */
+void CMsxMemSlotSystem::ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const
+{
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const size_t n = std::min(rest, pageRest(ad));
+		m_PageDev[ad / Z80_PAGE_SIZE].pObj->ReadBlock(pDest, ad, n);
+		if( ad + n - 1 == 0xffff )
+			pDest[n - 1] = readExtSlot();
+		ad = static_cast<z80memaddr_t>(ad + n), pDest += n, rest -= n;
+	}
+	return;
+}
+
+/** src から dest へ size バイト転送する（LDIR と同じく、先頭から１バイトずつ転送したのと同じ結果になる）
+ * RAM どうしの転送は、書き込んだ値を後で読むことにならない長さずつまとめて行う。
+ */
+void CMsxMemSlotSystem::CopyBlock(const z80memaddr_t dest, const z80memaddr_t src, const size_t size)
+{
+	uint8_t buff[256];
+	z80memaddr_t sad = src, dad = dest;
+	size_t rest = size;
+	const size_t dist = static_cast<z80memaddr_t>(dest - src);	// 転送先が後ろにある距離
+	while( 0 < rest ){
+		size_t n = std::min(std::min(rest, sizeof(buff)), std::min(pageRest(sad), pageRest(dad)));
+		if( 0 < dist && dist < n )
+			n = dist;
+		const PAGEDEV &spd = m_PageDev[sad / Z80_PAGE_SIZE];
+		const PAGEDEV &dpd = m_PageDev[dad / Z80_PAGE_SIZE];
+		if( spd.Type == DEVTYPE_RAM && dpd.Type == DEVTYPE_RAM &&
+			sad + n - 1 != 0xffff && !isSpecialWrite(dad, n) ){
+			static_cast<const CMsxMemoryMapper*>(spd.pObj)->ReadBlock(buff, sad, n);
+			static_cast<CMsxMemoryMapper*>(dpd.pObj)->WriteBlock(dad, buff, n);
+		}
+		else{
+			for( size_t t = 0; t < n; ++t )
+				Write(static_cast<z80memaddr_t>(dad + t), Read(static_cast<z80memaddr_t>(sad + t)));
+		}
+		sad = static_cast<z80memaddr_t>(sad + n), dad = static_cast<z80memaddr_t>(dad + n), rest -= n;
+	}
+	return;
 }
 
-void CMsxMemSlotSystem::Write(const z80memaddr_t addr, const uint8_t b)
+/** RAM 以外の装置への書き込み
+ */
+void CMsxMemSlotSystem::writeDevice(const PAGEDEV &pd, const z80memaddr_t addr, const uint8_t b)
+{
+	switch(pd.Type)
+	{
+		case DEVTYPE_VOID:
+			break;
+		case DEVTYPE_RAM:
+			static_cast<CMsxMemoryMapper*>(pd.pObj)->WriteMem(addr, b);
+			break;
+		case DEVTYPE_SCC:
+			static_cast<CScc*>(pd.pObj)->WriteMem(addr, b);
+			break;
+		default:
+			pd.pObj->WriteMem(addr, b);
+			break;
+	}
+	return;
+}
+
+/** RAM 以外の装置からの読み込み
+ */
+uint8_t CMsxMemSlotSystem::readDevice(const PAGEDEV &pd, const z80memaddr_t addr) const
+{
+	switch(pd.Type)
+	{
+		case DEVTYPE_VOID:
+			return m_VoidMem.ReadMem(addr);
+		case DEVTYPE_RAM:
+			return static_cast<const CMsxMemoryMapper*>(pd.pObj)->ReadMem(addr);
+		case DEVTYPE_SCC:
+			return static_cast<const CScc*>(pd.pObj)->ReadMem(addr);
+		default:
+			return pd.pObj->ReadMem(addr);
+	}
+}
+
+/** FFFFh への書き込みと、ループ検出で見ている範囲への書き込み
+ */
+void CMsxMemSlotSystem::writeSpecial(const z80memaddr_t addr, const uint8_t b)
 {
 	if( addr == 0xffff ) {
 		// FFFFHへのアクセスに従い、拡張スロットを切り替える
@@ -97,39 +289,35 @@ void CMsxMemSlotSystem::Write(const z80memaddr_t addr, const uint8_t b)
 		m_SlotNoToPage[MEMPAGE_1].ExtNo = static_cast<SLOTNO>((b >> 2) & 0x3);
 		m_SlotNoToPage[MEMPAGE_2].ExtNo = static_cast<SLOTNO>((b >> 4) & 0x3);
 		m_SlotNoToPage[MEMPAGE_3].ExtNo = static_cast<SLOTNO>((b >> 6) & 0x3);
+		updatePages();
 	}
 	else {
+		// ROMなど書き込めない場合もあるので、実際に書き込まれた値で更新する
+		const uint8_t old = readByte(addr);
 		writeByte(addr, b);
+		m_pLoopDetector->Update(CLoopDetector::KEY_MEMORY + addr, old, readByte(addr));
 	}
 	return;
 }
 
-uint8_t CMsxMemSlotSystem::Read(const z80memaddr_t addr) const
+/** FFFFh の読み込み（拡張スロットの選択状態の反転）
+ */
+uint8_t CMsxMemSlotSystem::readExtSlot() const
 {
-	uint8_t v;
-	if( addr == 0xffff ) {
-		v = ((m_SlotNoToPage[MEMPAGE_0].ExtNo & 0x03) << 0) |
-			((m_SlotNoToPage[MEMPAGE_1].ExtNo & 0x03) << 2) | 
-			((m_SlotNoToPage[MEMPAGE_2].ExtNo & 0x03) << 4) | 
-			((m_SlotNoToPage[MEMPAGE_3].ExtNo & 0x03) << 6); 
-		v ^= 0xff;	
-	}
-	else{
-		v = readByte(addr);
-	}
+	uint8_t v =
+		((m_SlotNoToPage[MEMPAGE_0].ExtNo & 0x03) << 0) |
+		((m_SlotNoToPage[MEMPAGE_1].ExtNo & 0x03) << 2) | 
+		((m_SlotNoToPage[MEMPAGE_2].ExtNo & 0x03) << 4) | 
+		((m_SlotNoToPage[MEMPAGE_3].ExtNo & 0x03) << 6); 
+	v ^= 0xff;	
 	return v;
 }
 
-int8_t CMsxMemSlotSystem::ReadInt8(const z80memaddr_t addr) const
-{
-	return static_cast<int8_t>(readByte(addr));
-}
-
 uint16_t CMsxMemSlotSystem::ReadWord(const z80memaddr_t addr) const
 {
 	uint16_t v;
-	v = Read(0xFC9E + 0);
-	v |= Read(0xFC9E + 1) << 8;
+	v = Read(addr + 0);
+	v |= Read(addr + 1) << 8;
 	return v;
 }
 
@@ -158,6 +346,7 @@ bool CMsxMemSlotSystem::OutPort(const z80ioaddr_t addr, const uint8_t b)
 		m_SlotNoToPage[MEMPAGE_1].BaseNo = static_cast<SLOTNO>((b >> 2) & 0x3);
 		m_SlotNoToPage[MEMPAGE_2].BaseNo = static_cast<SLOTNO>((b >> 4) & 0x3);
 		m_SlotNoToPage[MEMPAGE_3].BaseNo = static_cast<SLOTNO>((b >> 6) & 0x3);
+		updatePages();
 		return true;
 	}
 	return false;
@@ -174,3 +363,7 @@ bool CMsxMemSlotSystem::InPort(uint8_t *pB, const z80ioaddr_t addr)
 	}
 	return false;
 }
+bool CMsxMemSlotSystem::HasPort(const z80ioaddr_t addr) const
+{
+	return addr == 0xa8;
+}
@@ -2,8 +2,17 @@
 #include "msxdef.h"
 #include "msxdef.h"
 #include "CMsxVoidMemory.h"
+#include "CMsxMemoryMapper.h"
+#include "CScc.h"
 #include <vector>
 
+class CLoopDetector;
+
+/** スロットとメモリ装置
+ * 装置の型が分かっているもの（RAM/SCC/空き）は、仮想関数を通さずに呼び出す。
+ * 特に RAM の読み書きはヘッダでインライン展開されるので、命令の読み込みなどの大半がここで済む。
+ * それ以外の装置は IZ80MemoryDevice の仮想関数で呼び出す。
+ */
 class CMsxMemSlotSystem : public IZ80IoDevice
 {
 private:
@@ -12,33 +21,94 @@ private:
 		PAGEBIND() : BaseNo(SLOTNO_0), ExtNo(SLOTNO_0){return;}
 		PAGEBIND(SLOTNO b, SLOTNO e) : BaseNo(b), ExtNo(e){return;}
 	};
+	enum DEVTYPE { DEVTYPE_VOID, DEVTYPE_RAM, DEVTYPE_SCC, DEVTYPE_OTHER };
+	struct PAGEDEV {
+		DEVTYPE				Type;
+		IZ80MemoryDevice	*pObj;
+	};
 
 private:
 	//
 	CMsxVoidMemory m_VoidMem;
 	// 各ページに対応するメモリ装置オブジェクトへのポインタを保持する
 	IZ80MemoryDevice* m_MemObjs[SLOTNO_NUM][SLOTNO_NUM];	// 基本スロット：拡張スロット
+	DEVTYPE m_MemTypes[SLOTNO_NUM][SLOTNO_NUM];
 	// CPUメモリ空間を構成する各ページの、現在のスロット番号を保持する
 	PAGEBIND m_SlotNoToPage[MEMPAGENO_NUM];
+	// 各ページに現在見えているメモリ装置（スロットを切り替えたときに更新する）
+	PAGEDEV m_PageDev[MEMPAGENO_NUM];
+	bool m_bStaticDispatch;		// false=全ての装置を仮想関数で呼び出す（比較用）
+	// 書き込みをループ検出のハッシュに反映するアドレス範囲
+	CLoopDetector *m_pLoopDetector;
+	z80memaddr_t m_WatchBegin, m_WatchEnd;
 
 public:
 	CMsxMemSlotSystem();
 	virtual ~CMsxMemSlotSystem();
 
 public:
+	void JoinObject(const SLOTNO baseSlotNo, const SLOTNO extSlotNo, CMsxMemoryMapper *pObj);
+	void JoinObject(const SLOTNO baseSlotNo, const SLOTNO extSlotNo, CScc *pObj);
 	void JoinObject(const SLOTNO baseSlotNo, const SLOTNO extSlotNo, IZ80MemoryDevice *pObj);
 	void ChangeSlot(const MEMPAGENO pageNo, const SLOTNO baseSlotNo, const SLOTNO extSlotNo);
 	void GetSlot(SLOTNO *pBaseSlotNo, SLOTNO *pExtSlotNo, const MEMPAGENO pageNo);
 	void BinaryTo(const z80memaddr_t dest, const std::vector<uint8_t> &block);
+	void WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size);
+	void ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const;
+	void FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size);
+	void CopyBlock(const z80memaddr_t dest, const z80memaddr_t src, const size_t size);
+	void SetLoopDetector(CLoopDetector *pDetector, const z80memaddr_t begin, const z80memaddr_t end);
+	void SetStaticDispatch(const bool bStatic);
 
 private:
-	void writeByte(const z80memaddr_t addr, const uint8_t b);
-	uint8_t readByte(const z80memaddr_t addr) const;
+	void joinObject(const SLOTNO baseSlotNo, const SLOTNO extSlotNo, IZ80MemoryDevice *pObj, const DEVTYPE type);
+	void updatePages();
+	uint8_t readDevice(const PAGEDEV &pd, const z80memaddr_t addr) const;
+	void writeDevice(const PAGEDEV &pd, const z80memaddr_t addr, const uint8_t b);
+	void writeSpecial(const z80memaddr_t addr, const uint8_t b);
+	uint8_t readExtSlot() const;
+	bool isSpecialWrite(const z80memaddr_t addr, const size_t size) const;
+	static size_t pageRest(const z80memaddr_t addr);
+
+	uint8_t readByte(const z80memaddr_t addr) const
+	{
+		const PAGEDEV &pd = m_PageDev[addr / Z80_PAGE_SIZE];
+		if( pd.Type == DEVTYPE_RAM )
+			return static_cast<const CMsxMemoryMapper*>(pd.pObj)->ReadMem(addr);
+		return readDevice(pd, addr);
+	}
+	void writeByte(const z80memaddr_t addr, const uint8_t b)
+	{
+		const PAGEDEV &pd = m_PageDev[addr / Z80_PAGE_SIZE];
+		if( pd.Type == DEVTYPE_RAM ){
+			static_cast<CMsxMemoryMapper*>(pd.pObj)->WriteMem(addr, b);
+			return;
+		}
+		writeDevice(pd, addr, b);
+		return;
+	}
 
 public:
-	void Write(const z80memaddr_t addr, const uint8_t b);
-	uint8_t Read(const z80memaddr_t addr) const;
-	int8_t ReadInt8(const z80memaddr_t addr) const;
+	/** FFFFh（拡張スロットの選択）と、ループ検出で見ている範囲への書き込み以外は、そのまま装置に書き込む */
+	void Write(const z80memaddr_t addr, const uint8_t b)
+	{
+		if( addr == 0xffff || (m_pLoopDetector != nullptr && m_WatchBegin <= addr && addr <= m_WatchEnd) ){
+			writeSpecial(addr, b);
+			return;
+		}
+		writeByte(addr, b);
+		return;
+	}
+	uint8_t Read(const z80memaddr_t addr) const
+	{
+		if( addr == 0xffff )
+			return readExtSlot();
+		return readByte(addr);
+	}
+	int8_t ReadInt8(const z80memaddr_t addr) const
+	{
+		return static_cast<int8_t>(readByte(addr));
+	}
 	void Push16(const uint16_t w);
 	void ReadString(std::string *pStr, z80memaddr_t srcAddr);
 	uint16_t ReadWord(const z80memaddr_t addr) const;
@@ -48,4 +118,5 @@ public:
 public:
 	bool OutPort(const z80ioaddr_t addr, const uint8_t b);
 	bool InPort(uint8_t *pB, const z80ioaddr_t addr);
+	bool HasPort(const z80ioaddr_t addr) const;
 };
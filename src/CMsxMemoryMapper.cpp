@@ -0,0 +1,278 @@
+﻿#include "stdafx.h"
+#include "msxdef.h"
+#include "CMsxMemoryMapper.h"
+#include <memory.h>
+#include <algorithm>
+
+/**
+ * @param numSegments セグメント数（4～256、2のべき乗に切り上げる）
+ * @param v 初期値
+ */
+CMsxMemoryMapper::CMsxMemoryMapper(const int numSegments, const uint8_t v)
+{
+	m_NumSegments = MIN_SEGMENTS;
+	while( m_NumSegments < numSegments && m_NumSegments < MAX_SEGMENTS )
+		m_NumSegments *= 2;
+	for( int t = 0; t < MAX_SEGMENTS; ++t )
+		m_bShared[t] = false;
+	for(int t = 0; t < MEMPAGENO_NUM; ++t )
+		m_AssignedSegmentToPage[t] = MEMPAGENO_NUM - t - 1;
+	Clear(v);
+	return;
+}
+CMsxMemoryMapper::~CMsxMemoryMapper()
+{
+	freeSegments();
+	return;
+}
+
+/** 全セグメントを解放して、初期値 v で埋めた状態に戻す
+ */
+void CMsxMemoryMapper::Clear(const uint8_t v)
+{
+	freeSegments();
+	memset(m_InitSegment, v, sizeof(m_InitSegment));
+	mapPages();
+	return;
+}
+
+/** 全セグメントを自分専用に確保して一度書き換え、物理メモリを割り当てさせておく（内容は変えない）
+ * 演奏中にセグメントの確保や複製が起きないようにする。
+ */
+void CMsxMemoryMapper::Prefault()
+{
+	static const int PAGE_SIZE = 4096;
+	for( int seg = 0; seg < m_NumSegments; ++seg ){
+		if( m_Segments[seg] == nullptr || m_bShared[seg] )
+			copySegment(seg);
+		volatile uint8_t *p = m_Segments[seg].get();
+		for( int t = 0; t < Z80_PAGE_SIZE; t += PAGE_SIZE )
+			p[t] = p[t];
+	}
+	mapPages();
+	return;
+}
+
+int CMsxMemoryMapper::GetNumSegments() const
+{
+	return m_NumSegments;
+}
+
+/** 自分専用に確保しているセグメントの数（共有しているものは数えない）
+ */
+int CMsxMemoryMapper::GetNumAllocatedSegments() const
+{
+	int num = 0;
+	for( int seg = 0; seg < m_NumSegments; ++seg ){
+		if( m_Segments[seg] != nullptr && !m_bShared[seg] )
+			++num;
+	}
+	return num;
+}
+
+/** 全セグメントを共有中にして、以降の書き込みは複製してから行う
+ * 他のインスタンスが ShareSegments() で参照する前に、参照元で呼んでおく。
+ */
+void CMsxMemoryMapper::Freeze()
+{
+	for( int seg = 0; seg < m_NumSegments; ++seg )
+		m_bShared[seg] = (m_Segments[seg] != nullptr);
+	mapPages();
+	return;
+}
+
+/** Freeze() した tmpl と内容が同じセグメントは、自分の実体を捨てて tmpl のものを共有する
+ * 内容を比べてから差し替えるので、読み出せる値は変わらない。
+ * 別スレッドから同じ tmpl に対して同時に呼んでよい（tmpl は読むだけ）。
+ * @return 共有に切り替えたセグメントの数
+ */
+int CMsxMemoryMapper::ShareSegments(const CMsxMemoryMapper &tmpl)
+{
+	int num = 0;
+	const int numSegs = std::min(m_NumSegments, tmpl.m_NumSegments);
+	for( int seg = 0; seg < numSegs; ++seg ){
+		const std::shared_ptr<uint8_t> &src = tmpl.m_Segments[seg];
+		if( m_Segments[seg] == nullptr || m_bShared[seg] || src == nullptr || !tmpl.m_bShared[seg] )
+			continue;
+		if( memcmp(m_Segments[seg].get(), src.get(), Z80_PAGE_SIZE) != 0 )
+			continue;
+		m_Segments[seg] = src;
+		m_bShared[seg] = true;
+		++num;
+	}
+	mapPages();
+	return num;
+}
+
+/** ページに割り付けているセグメントの番号
+ */
+int CMsxMemoryMapper::GetPageSegment(const int pageNo) const
+{
+	return m_AssignedSegmentToPage[pageNo];
+}
+
+/** ページにセグメントを割り付ける（実機と同じく、セグメント数を超える上位ビットは無視する）
+ */
+void CMsxMemoryMapper::SetPageSegment(const int pageNo, const int seg)
+{
+	m_AssignedSegmentToPage[pageNo] = seg & (m_NumSegments - 1);
+	mapPage(pageNo);
+	return;
+}
+
+/** ページに割り付けずに、セグメントの内容を直接読む
+ * @param addr 上位2ビットは無視して、セグメント内のオフセットとする
+ */
+uint8_t CMsxMemoryMapper::ReadSegment(const int seg, const z80memaddr_t addr) const
+{
+	const uint8_t *p = m_Segments[seg & (m_NumSegments - 1)].get();
+	return ((p != nullptr) ? p : m_InitSegment)[addr % Z80_PAGE_SIZE];
+}
+
+/** ページに割り付けずに、セグメントに直接書き込む
+ * @param addr 上位2ビットは無視して、セグメント内のオフセットとする
+ */
+void CMsxMemoryMapper::WriteSegment(const int seg, const z80memaddr_t addr, const uint8_t b)
+{
+	const int segNo = seg & (m_NumSegments - 1);
+	if( m_Segments[segNo] == nullptr || m_bShared[segNo] ){
+		copySegment(segNo);
+		mapPages();
+	}
+	m_Segments[segNo].get()[addr % Z80_PAGE_SIZE] = b;
+	return;
+}
+
+void CMsxMemoryMapper::freeSegments()
+{
+	for( int seg = 0; seg < MAX_SEGMENTS; ++seg ){
+		m_Segments[seg].reset();
+		m_bShared[seg] = false;
+	}
+	return;
+}
+
+/** ページに割り付けたセグメントの読み書き先を決める
+ */
+void CMsxMemoryMapper::mapPage(const int pageNo)
+{
+	const int seg = m_AssignedSegmentToPage[pageNo];
+	uint8_t *p = m_Segments[seg].get();
+	m_pWritePage[pageNo] = m_bShared[seg] ? nullptr : p;
+	m_pReadPage[pageNo] = (p != nullptr) ? p : m_InitSegment;
+	return;
+}
+
+void CMsxMemoryMapper::mapPages()
+{
+	for(int t = 0; t < MEMPAGENO_NUM; ++t )
+		mapPage(t);
+	return;
+}
+
+/** セグメントの今の内容（未確保なら初期値、共有中なら共有元）を、自分専用の実体に複製する
+ */
+void CMsxMemoryMapper::copySegment(const int seg)
+{
+	const uint8_t *pSrc = (m_Segments[seg] != nullptr) ? m_Segments[seg].get() : m_InitSegment;
+	std::shared_ptr<uint8_t> p(GCC_NEW uint8_t[Z80_PAGE_SIZE], std::default_delete<uint8_t[]>());
+	memcpy(p.get(), pSrc, Z80_PAGE_SIZE);
+	m_Segments[seg] = p;
+	m_bShared[seg] = false;
+	return;
+}
+
+/** ページに割り付けたセグメントを書き込めるようにする（未確保か共有中のセグメントへの初回の書き込み時）
+ * 同じセグメントを複数のページに割り付けていることがあるので、全ページの読み書き先を更新する。
+ */
+uint8_t *CMsxMemoryMapper::allocPage(const int pageNo)
+{
+	copySegment(m_AssignedSegmentToPage[pageNo]);
+	mapPages();
+	return m_pWritePage[pageNo];
+}
+
+/** 連続した領域の読み書きは、セグメントごとに memcpy/memset で行う
+ */
+void CMsxMemoryMapper::WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size)
+{
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const int pageNo = ad / Z80_PAGE_SIZE;
+		const int offset = ad % Z80_PAGE_SIZE;
+		const size_t n = std::min<size_t>(rest, Z80_PAGE_SIZE - offset);
+		uint8_t *p = m_pWritePage[pageNo];
+		if( p == nullptr )
+			p = allocPage(pageNo);
+		memcpy(&p[offset], pSrc, n);
+		ad = static_cast<z80memaddr_t>(ad + n), pSrc += n, rest -= n;
+	}
+	return;
+}
+
+void CMsxMemoryMapper::ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const
+{
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const int offset = ad % Z80_PAGE_SIZE;
+		const size_t n = std::min<size_t>(rest, Z80_PAGE_SIZE - offset);
+		memcpy(pDest, &m_pReadPage[ad / Z80_PAGE_SIZE][offset], n);
+		ad = static_cast<z80memaddr_t>(ad + n), pDest += n, rest -= n;
+	}
+	return;
+}
+
+void CMsxMemoryMapper::FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size)
+{
+	z80memaddr_t ad = addr;
+	size_t rest = size;
+	while( 0 < rest ){
+		const int pageNo = ad / Z80_PAGE_SIZE;
+		const int offset = ad % Z80_PAGE_SIZE;
+		const size_t n = std::min<size_t>(rest, Z80_PAGE_SIZE - offset);
+		uint8_t *p = m_pWritePage[pageNo];
+		if( p == nullptr )
+			p = allocPage(pageNo);
+		memset(&p[offset], b, n);
+		ad = static_cast<z80memaddr_t>(ad + n), rest -= n;
+	}
+	return;
+}
+
+bool CMsxMemoryMapper::OutPort(const z80ioaddr_t addr, const uint8_t b)
+{
+// ページ毎にメモリマッパーセグメントを割り付けることができます。
+// それをI/Oポート FCh～FFhで行います。
+// MSX-Datapackのその対応の記載は間違いらしい。
+// 正しくは、
+// 	FCH = ページ0
+// 	FDH = ページ1
+// 	FEH = ページ2
+// 	FFH = ページ3
+// 情報源：http://map.grauw.nl/resources/msx_io_ports.php
+
+	bool bRet= false;
+	if( 0xFC <= addr && addr <= 0xFF ){
+		SetPageSegment(addr - 0xFC, b);
+		bRet= true;
+	}
+	return bRet;
+}
+
+bool CMsxMemoryMapper::InPort(uint8_t *pB, const z80ioaddr_t addr)
+{
+	bool bRet= false;
+	if( 0xFC <= addr && addr <= 0xFF ){
+		auto pageNo = static_cast<MEMPAGENO>(addr - 0xFC);
+		*pB = static_cast<uint8_t>(m_AssignedSegmentToPage[pageNo]);
+		bRet= true;
+	}
+	return bRet;
+}
+
+bool CMsxMemoryMapper::HasPort(const z80ioaddr_t addr) const
+{
+	return 0xFC <= addr && addr <= 0xFF;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+﻿#pragma once
+#include "msxdef.h"
+#include <memory>
+
+/** メモリマッパ付きのRAM
+ * セグメント数は 4～256（64K～4MBytes）で、2のべき乗に切り上げる。
+ * セグメントの実体は最初に書き込んだときに確保する。まだ書き込んでいないセグメントは、
+ * 初期値で埋めた読み出し専用の１セグメントを共有して読む。
+ * Freeze() したインスタンスのセグメントは、ShareSegments() で他のインスタンスから共有できる。
+ * 共有しているセグメントは、どちらも最初に書き込んだときに複製する（コピーオンライト）。
+ */
+class CMsxMemoryMapper final : public IZ80MemoryDevice, public IZ80IoDevice
+{
+public:
+	static const int MIN_SEGMENTS = 4;			// ページ0～3の初期値のセグメント
+	static const int MAX_SEGMENTS = 256;		// 256 * 16[KBytes] = 4[MBytes]
+	static const int DEFAULT_SEGMENTS = 16;		// 16 * 16[KBytes] = 256[KBytes]
+
+private:
+	int m_NumSegments;
+	std::shared_ptr<uint8_t> m_Segments[MAX_SEGMENTS];	// 確保したセグメント（nullptr=未確保）
+	bool m_bShared[MAX_SEGMENTS];				// true=他のインスタンスと共有している（書き込む前に複製する）
+	int m_AssignedSegmentToPage[MEMPAGENO_NUM];	// 各ページに割り付けているセグメントの番号０～
+	const uint8_t *m_pReadPage[MEMPAGENO_NUM];
+	uint8_t *m_pWritePage[MEMPAGENO_NUM];		// nullptr=セグメントが未確保か共有中
+	uint8_t m_InitSegment[Z80_PAGE_SIZE];		// 未確保のセグメントの内容
+
+public:
+	explicit CMsxMemoryMapper(const int numSegments = DEFAULT_SEGMENTS, const uint8_t v = 0x00);
+	virtual ~CMsxMemoryMapper();
+
+public:
+	void Clear(const uint8_t v);
+	void Prefault();
+	int GetNumSegments() const;
+	int GetNumAllocatedSegments() const;
+	void Freeze();
+	int ShareSegments(const CMsxMemoryMapper &tmpl);
+	int GetPageSegment(const int pageNo) const;
+	void SetPageSegment(const int pageNo, const int seg);
+	uint8_t ReadSegment(const int seg, const z80memaddr_t addr) const;
+	void WriteSegment(const int seg, const z80memaddr_t addr, const uint8_t b);
+
+private:
+	void freeSegments();
+	void mapPage(const int pageNo);
+	void mapPages();
+	void copySegment(const int seg);
+	uint8_t *allocPage(const int pageNo);
+
+public:
+/*IZ80MemoryDevice*/
+	// CMsxMemSlotSystem から仮想関数を通さずに呼ばれるので、ここに書いてインライン展開させる
+	bool WriteMem(const z80memaddr_t addr, const uint8_t b)
+	{
+		uint8_t *p = m_pWritePage[addr / Z80_PAGE_SIZE];
+		if( p == nullptr )
+			p = allocPage(addr / Z80_PAGE_SIZE);
+		p[addr % Z80_PAGE_SIZE] = b;
+		return true;
+	}
+	uint8_t ReadMem(const z80memaddr_t addr) const
+	{
+		return m_pReadPage[addr / Z80_PAGE_SIZE][addr % Z80_PAGE_SIZE];
+	}
+	void WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size);
+	void ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const;
+	void FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size);
+/*IZ80IoDevice*/
+	bool OutPort(const z80ioaddr_t addr, const uint8_t b);
+	bool InPort(uint8_t *pB, const z80ioaddr_t addr);
+	bool HasPort(const z80ioaddr_t addr) const;
+};
+
+
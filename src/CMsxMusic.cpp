@@ -3,41 +3,203 @@
 #include "CMsxMusic.h"
 #include <memory.h>
 #include "RmmChipMuse.h"
+#include "CLoopDetector.h"
+#include "CChipPipeline.h"
 
-CMsxMusic::CMsxMusic()
+/**
+ * @param bHeadless true なら実チップには一切アクセスしない（インデクサ等の高速実行用）
+ */
+CMsxMusic::CMsxMusic(const bool bHeadless)
 {
-	m_pOpll = GCC_NEW RmmChipMuse(RmmChipMuse::OPLL);
-	m_pPsg = GCC_NEW RmmChipMuse(RmmChipMuse::PSG);
-	m_pOpll->Init();
-	m_pPsg->Init();
+	m_pOpll = nullptr;
+	m_pPsg = nullptr;
+	m_OpllAddr = m_PsgAddr = 0;
+	memset(m_OpllRegs, 0, sizeof(m_OpllRegs));
+	memset(m_PsgRegs, 0, sizeof(m_PsgRegs));
+	memset(m_OpllOut, 0, sizeof(m_OpllOut));
+	memset(m_PsgOut, 0, sizeof(m_PsgOut));
+	m_bOutput = true;
+	m_OpllKeyOff = 0;
+	m_bPsgEnvWritten = false;
+	m_pLoopDetector = nullptr;
+	m_pOutput = nullptr;
+	if( !bHeadless ){
+		m_pOpll = GCC_NEW RmmChipMuse(RmmChipMuse::OPLL);
+		m_pPsg = GCC_NEW RmmChipMuse(RmmChipMuse::PSG);
+		m_pOpll->Init();
+		m_pPsg->Init();
+	}
 	return;
 }
 CMsxMusic::~CMsxMusic()
 {
-	m_pOpll->SetRegister(0x0e, 0x20);
-	m_pOpll->SetRegister(0x36, 0x00);
-	m_pOpll->SetRegister(0x37, 0x00);
-	m_pOpll->SetRegister(0x38, 0x00);
-
-	m_pOpll->SetRegister(0x0e, 0x00);
-	m_pOpll->SetRegister(0x30, 0x0F);
-	m_pOpll->SetRegister(0x31, 0x0F);
-	m_pOpll->SetRegister(0x32, 0x0F);
-	m_pOpll->SetRegister(0x33, 0x0F);
-	m_pOpll->SetRegister(0x34, 0x0F);
-	m_pOpll->SetRegister(0x35, 0x0F);
-	m_pOpll->SetRegister(0x36, 0x0F);
-	m_pOpll->SetRegister(0x37, 0x0F);
-	m_pOpll->SetRegister(0x38, 0x0F);
-	
-	m_pPsg->SetRegister(0x08, 0x00);
-	m_pPsg->SetRegister(0x09, 0x00);
-	m_pPsg->SetRegister(0x0A, 0x00);
+	Mute();
 	NULL_DELETE(m_pOpll);
 	NULL_DELETE(m_pPsg);
 	return;
 }
 
+/** 消音するときのレジスタへの書き込み（この順に書く）
+ */
+static const uint8_t MUTE_OPLL[][2] =
+{
+	{ 0x20, 0x00 }, { 0x21, 0x00 }, { 0x22, 0x00 }, { 0x23, 0x00 }, { 0x24, 0x00 },
+	{ 0x25, 0x00 }, { 0x26, 0x00 }, { 0x27, 0x00 }, { 0x28, 0x00 },
+	{ 0x0e, 0x20 }, { 0x36, 0x00 }, { 0x37, 0x00 }, { 0x38, 0x00 },
+	{ 0x0e, 0x00 }, { 0x30, 0x0F }, { 0x31, 0x0F }, { 0x32, 0x0F }, { 0x33, 0x0F }, { 0x34, 0x0F },
+	{ 0x35, 0x0F }, { 0x36, 0x0F }, { 0x37, 0x0F }, { 0x38, 0x0F },
+};
+static const uint8_t MUTE_PSG[][2] = { { 0x08, 0x00 }, { 0x09, 0x00 }, { 0x0A, 0x00 } };
+
+/** 全チャンネルをキーオフし、音量を最小にする
+ */
+void CMsxMusic::Mute()
+{
+	for( auto &w : MUTE_OPLL )
+		setOpll(w[0], w[1]);
+	for( auto &w : MUTE_PSG )
+		setPsg(w[0], w[1]);
+	return;
+}
+
+/** 記録しているレジスタの内容はそのままで、実チップだけを消音する（一時停止用）
+ * Resync() で、消音する前の状態に戻る。
+ */
+void CMsxMusic::Silence()
+{
+	if( m_pOpll == nullptr )
+		return;
+	for( auto &w : MUTE_OPLL ){
+		m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_REG, w[0], w[1]);
+		m_OpllOut[w[0]] = w[1];
+	}
+	for( auto &w : MUTE_PSG ){
+		m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_REG, w[0], w[1]);
+		m_PsgOut[w[0]] = w[1];
+	}
+	return;
+}
+
+/** レジスタへの書き込みをループ検出のハッシュに反映する
+ */
+void CMsxMusic::SetLoopDetector(CLoopDetector *pDetector)
+{
+	m_pLoopDetector = pDetector;
+	return;
+}
+
+/** 実チップへの書き込みはすべて pOutput を通す（実チップを使う場合は必須）
+ */
+void CMsxMusic::SetChipOutput(CChipPipeline *pOutput)
+{
+	m_pOutput = pOutput;
+	return;
+}
+
+/** レジスタの内容を記録してから、チップに書き込む
+ */
+void CMsxMusic::setOpll(const uint8_t addr, const uint8_t b)
+{
+	uint8_t &reg = m_OpllRegs[addr & 0x3F];
+	if( m_pLoopDetector != nullptr )
+		m_pLoopDetector->Update(CLoopDetector::KEY_OPLL + (addr & 0x3F), reg, b);
+	reg = b;
+	if( !m_bOutput )
+		recordKeyOff(addr & 0x3F, b);
+	else if( m_pOpll != nullptr && !m_pOutput->SkipRedundant(m_OpllOut[addr & 0x3F], b) ){
+		m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_REG, addr, b);
+		m_OpllOut[addr & 0x3F] = b;
+	}
+	return;
+}
+
+void CMsxMusic::setPsg(const uint8_t addr, const uint8_t b)
+{
+	uint8_t &reg = m_PsgRegs[addr & 0x0F];
+	if( m_pLoopDetector != nullptr )
+		m_pLoopDetector->Update(CLoopDetector::KEY_PSG + (addr & 0x0F), reg, b);
+	reg = b;
+	if( !m_bOutput )
+		m_bPsgEnvWritten |= ((addr & 0x0F) == 13);
+	else if( m_pPsg != nullptr && !skipPsg(addr & 0x0F, b) ){
+		m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_REG, addr, b);
+		m_PsgOut[addr & 0x0F] = b;
+	}
+	return;
+}
+
+/** false にすると、レジスタへの書き込みを記録するだけで実チップには書き込まない（シークや、等倍より速い演奏用）
+ * 書き込まなかった分は Resync() でまとめて書き込む。
+ */
+void CMsxMusic::SetOutput(const bool bOutput)
+{
+	m_bOutput = bOutput;
+	return;
+}
+
+/** 記録しているレジスタの内容のうち、実チップと異なるものだけを書き込む
+ * キーオンは音色や音量を設定してから行いたいので、0x20-0x28 は最後に書く。
+ * 書き込まなかった間にキーオフしてキーオンし直したチャンネルは、一度キーオフしてから書く（発音し直す）。
+ * R#13 は、書き込みがあれば同じ値でも書き込む（エンベロープをやり直す）。
+ */
+void CMsxMusic::Resync()
+{
+	if( m_pOpll == nullptr )
+		return;
+	for( uint8_t addr = 0x00; addr < 0x20; ++addr )
+		syncOpll(addr);
+	for( uint8_t addr = 0x30; addr < 0x40; ++addr )
+		syncOpll(addr);
+	for( uint8_t addr = 0x20; addr < 0x30; ++addr ){
+		const uint8_t keyOff = m_OpllRegs[addr] & ~0x10;
+		if( (m_OpllKeyOff & (1 << (addr-0x20))) != 0 && (m_OpllOut[addr] & 0x10) != 0 && keyOff != m_OpllRegs[addr] ){
+			m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_REG, addr, keyOff);
+			m_OpllOut[addr] = keyOff;
+		}
+		syncOpll(addr);
+	}
+	m_OpllKeyOff = 0;
+	for( uint8_t addr = 0x00; addr < 0x10; ++addr ){
+		if( m_PsgRegs[addr] != m_PsgOut[addr] || (addr == 13 && m_bPsgEnvWritten) ){
+			m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_REG, addr, m_PsgRegs[addr]);
+			m_PsgOut[addr] = m_PsgRegs[addr];
+		}
+	}
+	m_bPsgEnvWritten = false;
+	// アドレスラッチを Z80 側の値に戻しておく（続けてデータだけを書き込まれてもよいように）
+	m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_ADDR, m_OpllAddr, 0);
+	m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_ADDR, m_PsgAddr, 0);
+	return;
+}
+
+/** 実チップに書き込まない間のキーオフを覚えておく（Resync() で発音し直すため）
+ */
+void CMsxMusic::recordKeyOff(const uint8_t addr, const uint8_t b)
+{
+	if( 0x20 <= addr && addr <= 0x28 && (b & 0x10) == 0 )
+		m_OpllKeyOff |= 1 << (addr-0x20);
+	return;
+}
+
+/** 過負荷のときに省いてよい PSG の書き込みか
+ * R#13（エンベロープの形）は、同じ値でも書き込むとエンベロープが最初からやり直しになるので省かない。
+ */
+bool CMsxMusic::skipPsg(const uint8_t addr, const uint8_t b)
+{
+	if( addr == 13 )
+		return false;
+	return m_pOutput->SkipRedundant(m_PsgOut[addr], b);
+}
+
+void CMsxMusic::syncOpll(const uint8_t addr)
+{
+	if( m_OpllRegs[addr] != m_OpllOut[addr] ){
+		m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_REG, addr, m_OpllRegs[addr]);
+		m_OpllOut[addr] = m_OpllRegs[addr];
+	}
+	return;
+}
+
 bool CMsxMusic::WriteMem(const z80memaddr_t addr, const uint8_t b)
 {
 	// do nothing
@@ -60,20 +222,46 @@ bool CMsxMusic::OutPort(const z80ioaddr_t addr, const uint8_t b)
 	{
 	// OPLL- REGISTAR ADDRESS RATCH
 	case 0x7C:
-		m_pOpll->SetRegisterAddr(b);
+		m_OpllAddr = b;
+		if( m_pOpll != nullptr && m_bOutput )
+			m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_ADDR, b, 0);
 		break;
 	// OPLL- REGISTAR DATA
 	case 0x7D:
-		m_pOpll->SetRegisterData(b);
+	{
+		uint8_t &reg = m_OpllRegs[m_OpllAddr & 0x3F];
+		if( m_pLoopDetector != nullptr )
+			m_pLoopDetector->Update(CLoopDetector::KEY_OPLL + (m_OpllAddr & 0x3F), reg, b);
+		reg = b;
+		if( !m_bOutput )
+			recordKeyOff(m_OpllAddr & 0x3F, b);
+		else if( m_pOpll != nullptr && !m_pOutput->SkipRedundant(m_OpllOut[m_OpllAddr & 0x3F], b) ){
+			m_pOutput->Write(m_pOpll, CFrameProfiler::CHIP_OPLL, CChipPipeline::OP_DATA, 0, b);
+			m_OpllOut[m_OpllAddr & 0x3F] = b;
+		}
 		break;
+	}
 	// PSG - REGISTAR ADDRESS RATCH
 	case 0xA0:
-		m_pPsg->SetRegisterAddr(b);
+		m_PsgAddr = b;
+		if( m_pPsg != nullptr && m_bOutput )
+			m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_ADDR, b, 0);
 		break;
 	// PSG - REGISTAR DATA
 	case 0xA1:
-		m_pPsg->SetRegisterData(b);
+	{
+		uint8_t &reg = m_PsgRegs[m_PsgAddr & 0x0F];
+		if( m_pLoopDetector != nullptr )
+			m_pLoopDetector->Update(CLoopDetector::KEY_PSG + (m_PsgAddr & 0x0F), reg, b);
+		reg = b;
+		if( !m_bOutput )
+			m_bPsgEnvWritten |= ((m_PsgAddr & 0x0F) == 13);
+		else if( m_pPsg != nullptr && !skipPsg(m_PsgAddr & 0x0F, b) ){
+			m_pOutput->Write(m_pPsg, CFrameProfiler::CHIP_PSG, CChipPipeline::OP_DATA, 0, b);
+			m_PsgOut[m_PsgAddr & 0x0F] = b;
+		}
 		break;
+	}
 	default:
 		bRetc = false;
 		break;
@@ -86,3 +274,8 @@ bool CMsxMusic::InPort(uint8_t *pB, const z80ioaddr_t addr)
 	// do nohing
 	return false;
 }
+
+bool CMsxMusic::HasPort(const z80ioaddr_t addr) const
+{
+	return addr == 0x7C || addr == 0x7D || addr == 0xA0 || addr == 0xA1;
+}
@@ -1,17 +1,43 @@
 #pragma once
 #include "msxdef.h"
 class RmmChipMuse;
+class CLoopDetector;
+class CChipPipeline;
 
 class CMsxMusic : public IZ80MemoryDevice, public IZ80IoDevice
 {
 private:
 	RmmChipMuse *m_pOpll;
 	RmmChipMuse *m_pPsg;
+	// レジスタの内容（エミュレーション上の値と、実チップに書き込み済みの値）
+	uint8_t m_OpllAddr, m_OpllRegs[0x40], m_OpllOut[0x40];
+	uint8_t m_PsgAddr, m_PsgRegs[0x10], m_PsgOut[0x10];
+	bool m_bOutput;		// false=実チップには書き込まない
+	// 実チップに書き込まない間に、キーオフされたチャンネルと、エンベロープ形状(R#13)の書き込みがあったか
+	uint16_t m_OpllKeyOff;
+	bool m_bPsgEnvWritten;
+	CLoopDetector *m_pLoopDetector;
+	CChipPipeline *m_pOutput;
 
 public:
-	CMsxMusic();
+	explicit CMsxMusic(const bool bHeadless = false);
 	virtual ~CMsxMusic();
 
+public:
+	void Mute();
+	void Silence();
+	void SetLoopDetector(CLoopDetector *pDetector);
+	void SetChipOutput(CChipPipeline *pOutput);
+	void SetOutput(const bool bOutput);
+	void Resync();
+
+private:
+	void setOpll(const uint8_t addr, const uint8_t b);
+	void setPsg(const uint8_t addr, const uint8_t b);
+	bool skipPsg(const uint8_t addr, const uint8_t b);
+	void recordKeyOff(const uint8_t addr, const uint8_t b);
+	void syncOpll(const uint8_t addr);
+
 public:
 /*IZ80MemoryDevice*/
 	bool WriteMem(const z80memaddr_t addr, const uint8_t b);
@@ -19,4 +45,5 @@ public:
 /*IZ80IoDevice*/
 	bool OutPort(const z80ioaddr_t addr, const uint8_t b);
 	bool InPort(uint8_t *pB, const z80ioaddr_t addr);
+	bool HasPort(const z80ioaddr_t addr) const;
 };
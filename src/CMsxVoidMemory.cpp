@@ -25,3 +25,21 @@ uint8_t CMsxVoidMemory::ReadMem(const z80memaddr_t addr) const
 {
 	return 0xff;
 }
+
+void CMsxVoidMemory::WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size)
+{
+	// do nothing
+	return;
+}
+
+void CMsxVoidMemory::ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const
+{
+	memset(pDest, 0xff, size);
+	return;
+}
+
+void CMsxVoidMemory::FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size)
+{
+	// do nothing
+	return;
+}
@@ -2,7 +2,7 @@
 #include "msxdef.h"
 #include "msxdef.h"
 
-class CMsxVoidMemory : public IZ80MemoryDevice
+class CMsxVoidMemory final : public IZ80MemoryDevice
 {
 public:
 	CMsxVoidMemory();
@@ -12,6 +12,9 @@ public:
 /*IZ80MemoryDevice*/
 	bool WriteMem(const z80memaddr_t addr, const uint8_t b);
 	uint8_t ReadMem(const z80memaddr_t addr) const;
+	void WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size);
+	void ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const;
+	void FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size);
 };
 
 
@@ -0,0 +1,173 @@
+﻿#include "stdafx.h"
+#include "tools.h"
+#include "CPlayList.h"
+#include <algorithm>
+#ifdef __linux
+#include <dirent.h>
+#endif
+
+#ifdef _WIN32
+static const TCHAR PATH_SEP = _T('\\');
+#else
+static const TCHAR PATH_SEP = _T('/');
+#endif
+
+CPlayList::CPlayList()
+{
+	m_PrefetchIndex = 0;
+	m_pPrefetchData = nullptr;
+	m_bPrefetchResult = false;
+	return;
+}
+
+CPlayList::~CPlayList()
+{
+	waitPrefetch();
+	NULL_DELETE(m_pPrefetchData);
+	return;
+}
+
+/** 演奏リストに追加する
+ * @param path MGSファイル、ディレクトリ、または m3uファイルのパス
+ * @return 1曲以上追加できたら true
+ */
+bool CPlayList::Add(const tstring &path)
+{
+	if( t_IsDirectory(path) )
+		return addDirectory(path);
+	if( t_HasExtension(path, _T(".m3u")) || t_HasExtension(path, _T(".m3u8")) )
+		return addM3u(path);
+	m_Files.push_back(path);
+	return true;
+}
+
+size_t CPlayList::GetNum() const
+{
+	return m_Files.size();
+}
+
+const tstring &CPlayList::GetPath(const size_t index) const
+{
+	assert(index < m_Files.size());
+	return m_Files[index];
+}
+
+/** 指定番号の曲のファイルを、バックグラウンドで読み込み始める
+ */
+void CPlayList::Prefetch(const size_t index)
+{
+	waitPrefetch();
+	NULL_DELETE(m_pPrefetchData);
+	if( m_Files.size() <= index )
+		return;
+	m_PrefetchIndex = index;
+	m_bPrefetchResult = false;
+	const tstring path = m_Files[index];
+	m_Prefetch = std::thread([this, path]() {
+		m_bPrefetchResult = t_ReadFile(path, &m_pPrefetchData);
+	});
+	return;
+}
+
+/** 指定番号の曲のファイルの内容を得る
+ * 先読み済みならそれを返し、そうでなければここで読み込む。
+ * @param pp 読み込んだデータ（呼び出し側で delete すること）
+ */
+bool CPlayList::Take(const size_t index, std::vector<uint8_t> **pp)
+{
+	assert(index < m_Files.size());
+	waitPrefetch();
+	if( m_pPrefetchData != nullptr && m_PrefetchIndex == index ){
+		bool bRet = m_bPrefetchResult;
+		*pp = m_pPrefetchData;
+		m_pPrefetchData = nullptr;
+		return bRet;
+	}
+	return t_ReadFile(m_Files[index], pp);
+}
+
+bool CPlayList::addDirectory(const tstring &dirPath)
+{
+	std::vector<tstring> names;
+#ifdef __linux
+	std::string path;
+	t_ToNarrow(dirPath, &path);
+	DIR *pDir = ::opendir(path.c_str());
+	if( pDir == nullptr )
+		return false;
+	for(struct dirent *pEnt = ::readdir(pDir); pEnt != nullptr; pEnt = ::readdir(pDir)){
+		tstring name;
+		t_ToWiden(pEnt->d_name, &name);
+		if( t_HasExtension(name, _T(".mgs")) )
+			names.push_back(name);
+	}
+	::closedir(pDir);
+#endif
+#ifdef _WIN32
+	WIN32_FIND_DATA fd;
+	HANDLE hFind = ::FindFirstFile((dirPath + PATH_SEP + _T("*.mgs")).c_str(), &fd);
+	if( hFind == INVALID_HANDLE_VALUE )
+		return false;
+	do {
+		if( (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0 )
+			names.push_back(fd.cFileName);
+	} while( ::FindNextFile(hFind, &fd) );
+	::FindClose(hFind);
+#endif
+	std::sort(names.begin(), names.end());
+	tstring base = dirPath;
+	if( !base.empty() && base[base.size()-1] != PATH_SEP )
+		base += PATH_SEP;
+	for( auto &name : names )
+		m_Files.push_back(base + name);
+	return !names.empty();
+}
+
+/** m3uファイルを読み込む。'#' で始まる行は無視する。
+ * 相対パスは m3uファイルの位置からのパスとして扱う。
+ */
+bool CPlayList::addM3u(const tstring &m3uPath)
+{
+	std::vector<uint8_t> *pText = nullptr;
+	if( !t_ReadFile(m3uPath, &pText) ){
+		NULL_DELETE(pText);
+		return false;
+	}
+	tstring base;
+	auto sepPos = m3uPath.rfind(PATH_SEP);
+	if( sepPos != tstring::npos )
+		base = m3uPath.substr(0, sepPos+1);
+
+	const size_t oldNum = m_Files.size();
+	std::string line;
+	for( size_t t = 0; t <= pText->size(); ++t ){
+		char ch = (t < pText->size()) ? static_cast<char>((*pText)[t]) : '\n';
+		if( ch != '\n' ){
+			if( ch != '\r' )
+				line += ch;
+			continue;
+		}
+		// UTF-8 の BOM を読み飛ばす
+		if( 3 <= line.size() && line.compare(0, 3, "\xEF\xBB\xBF") == 0 )
+			line.erase(0, 3);
+		if( !line.empty() && line[0] != '#' ){
+			tstring path;
+			t_ToWiden(line, &path);
+			bool bAbs = (path[0] == PATH_SEP);
+#ifdef _WIN32
+			bAbs = bAbs || (2 <= path.size() && path[1] == _T(':'));
+#endif
+			Add(bAbs ? path : (base + path));
+		}
+		line.clear();
+	}
+	NULL_DELETE(pText);
+	return oldNum < m_Files.size();
+}
+
+void CPlayList::waitPrefetch()
+{
+	if( m_Prefetch.joinable() )
+		m_Prefetch.join();
+	return;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "stdafx.h"
+#include <vector>
+#include <thread>
+
+/** 演奏リスト
+ * ファイル、ディレクトリ(*.mgs)、m3uファイルから演奏するMGSファイルの一覧を作る。
+ * 次の曲のファイルは、演奏中にバックグラウンドのスレッドで読み込んでおく。
+ */
+class CPlayList
+{
+private:
+	std::vector<tstring> m_Files;
+	std::thread m_Prefetch;
+	size_t m_PrefetchIndex;
+	std::vector<uint8_t> *m_pPrefetchData;
+	bool m_bPrefetchResult;
+
+public:
+	CPlayList();
+	virtual ~CPlayList();
+
+public:
+	bool Add(const tstring &path);
+	size_t GetNum() const;
+	const tstring &GetPath(const size_t index) const;
+	void Prefetch(const size_t index);
+	bool Take(const size_t index, std::vector<uint8_t> **pp);
+
+private:
+	bool addDirectory(const tstring &dirPath);
+	bool addM3u(const tstring &m3uPath);
+	void waitPrefetch();
+};
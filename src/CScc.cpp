@@ -3,21 +3,105 @@
 #include "CScc.h"
 #include <memory.h>
 #include "RmmChipMuse.h"
+#include "CLoopDetector.h"
+#include "CChipPipeline.h"
 
-CScc::CScc()
+/**
+ * @param bHeadless true なら実チップには一切アクセスしない
+ */
+CScc::CScc(const bool bHeadless)
 {
-	m_pScc = GCC_NEW RmmChipMuse(RmmChipMuse::SCC);
-	m_pScc->Init();
+	m_pScc = nullptr;
+	m_pLoopDetector = nullptr;
+	m_pOutput = nullptr;
+	if( !bHeadless ){
+		m_pScc = GCC_NEW RmmChipMuse(RmmChipMuse::SCC);
+		m_pScc->Init();
+	}
 	m_M9000 = 0;
+	memset(m_M9800, 0, sizeof(m_M9800));
+	m_Out9000 = 0x3f;	// RmmChipMuse::Init() の設定値
+	memset(m_Out9800, 0, sizeof(m_Out9800));
+	m_bOutput = true;
 	return;
 }
 CScc::~CScc()
 {
-	m_pScc->SetRegister(0x988F, 0);
+	Mute();
 	NULL_DELETE(m_pScc);
 	return;
 }
 
+/** 全チャンネルの出力を止める
+ */
+void CScc::Mute()
+{
+	if( m_pLoopDetector != nullptr )
+		m_pLoopDetector->Update(CLoopDetector::KEY_SCC + 0x8F, m_M9800[0x8F], 0);
+	m_M9800[0x8F] = 0;
+	if( m_pScc != nullptr && m_bOutput ){
+		m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, 0x988F, 0);
+		m_Out9800[0x8F] = 0;
+	}
+	return;
+}
+
+/** 記録しているレジスタの内容はそのままで、実チップだけを消音する（一時停止用）
+ * Resync() で、消音する前の状態に戻る。
+ */
+void CScc::Silence()
+{
+	if( m_pScc == nullptr )
+		return;
+	m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, 0x988F, 0);
+	m_Out9800[0x8F] = 0;
+	return;
+}
+
+/** レジスタへの書き込みをループ検出のハッシュに反映する
+ */
+void CScc::SetLoopDetector(CLoopDetector *pDetector)
+{
+	m_pLoopDetector = pDetector;
+	return;
+}
+
+/** 実チップへの書き込みはすべて pOutput を通す（実チップを使う場合は必須）
+ */
+void CScc::SetChipOutput(CChipPipeline *pOutput)
+{
+	m_pOutput = pOutput;
+	return;
+}
+
+/** false にすると、レジスタへの書き込みを記録するだけで実チップには書き込まない（シーク用）
+ */
+void CScc::SetOutput(const bool bOutput)
+{
+	m_bOutput = bOutput;
+	return;
+}
+
+/** 記録しているレジスタの内容のうち、実チップと異なるものだけを書き込む
+ * 波形、周波数、音量、チャンネルの有効化の順に並んでいるので、アドレス順に書けばよい。
+ */
+void CScc::Resync()
+{
+	if( m_pScc == nullptr )
+		return;
+	if( m_M9000 != m_Out9000 ){
+		m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, 0x9000, m_M9000);
+		m_Out9000 = m_M9000;
+	}
+	for( z80memaddr_t t = 0; t < MEM_SIZE; ++t ){
+		if( m_M9800[t] != m_Out9800[t] ){
+			m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, ADDR_START + t, m_M9800[t]);
+			m_Out9800[t] = m_M9800[t];
+		}
+	}
+	return;
+}
+
 void CScc::SetupHardware()
 {
 	return;
@@ -28,12 +112,20 @@ bool CScc::WriteMem(const z80memaddr_t addr, const uint8_t b)
 	bool bRetc = false;
 	if( addr == 0x9000 ){
 		m_M9000 = b;
-		m_pScc->SetRegister(addr, b);
+		if( m_pScc != nullptr && m_bOutput ){
+			m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, addr, b);
+			m_Out9000 = b;
+		}
 		bRetc = true;
 	}
 	else if(m_M9000 == 0x3f && ADDR_START <= addr && addr <= ADDR_END ){
+		if( m_pLoopDetector != nullptr )
+			m_pLoopDetector->Update(CLoopDetector::KEY_SCC + (addr-ADDR_START), m_M9800[addr-ADDR_START], b);
 		m_M9800[addr-ADDR_START] = b;
-		m_pScc->SetRegister(addr, b);
+		if( m_pScc != nullptr && m_bOutput && !m_pOutput->SkipRedundant(m_Out9800[addr-ADDR_START], b) ){
+			m_pOutput->Write(m_pScc, CFrameProfiler::CHIP_SCC, CChipPipeline::OP_REG, addr, b);
+			m_Out9800[addr-ADDR_START] = b;
+		}
 		bRetc = true;
 	}
 	return bRetc;
@@ -1,8 +1,10 @@
 #pragma once
 #include "msxdef.h"
 class RmmChipMuse;
+class CLoopDetector;
+class CChipPipeline;
 
-class CScc : public IZ80MemoryDevice
+class CScc final : public IZ80MemoryDevice
 {
 private:
 	static const z80memaddr_t ADDR_START = 0x9800;
@@ -10,14 +12,26 @@ private:
 	static const z80memaddr_t MEM_SIZE = (ADDR_END-ADDR_START+1);
 	uint8_t	m_M9000;
 	uint8_t	m_M9800[MEM_SIZE];
+	// 実チップに書き込み済みの値
+	uint8_t	m_Out9000;
+	uint8_t	m_Out9800[MEM_SIZE];
+	bool	m_bOutput;		// false=実チップには書き込まない
 	RmmChipMuse *m_pScc;
+	CLoopDetector *m_pLoopDetector;
+	CChipPipeline *m_pOutput;
 
 public:
-	CScc();
+	explicit CScc(const bool bHeadless = false);
 	virtual ~CScc();
 
 public:
 	void SetupHardware();
+	void Mute();
+	void Silence();
+	void SetLoopDetector(CLoopDetector *pDetector);
+	void SetChipOutput(CChipPipeline *pOutput);
+	void SetOutput(const bool bOutput);
+	void Resync();
 
 /*IZ80MemoryDevice*/
 public:
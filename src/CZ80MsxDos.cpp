@@ -3,14 +3,42 @@
 #include "CZ80MsxDos.h"
 #include "CMsxMemSlotSystem.h"
 #include "CMsxIoSystem.h"
-#include <chrono>
-#include <thread>	// for sleep_for
+#include "CMsxMemoryMapper.h"
+#include "CLoopDetector.h"
+#include "CFrameProfiler.h"
+#include "CChipPipeline.h"
+#include "CZ80Trace.h"
+#include "Z80TStates.h"
+#include <algorithm>
 
-CZ80MsxDos::CZ80MsxDos()
+static const int64_t FRAME_TIME_NS = 16600*1000;	// 16.6ms
+static const z80memaddr_t MM_RET_SEG = 0xFF30;		// インターセグメントコールからの戻り先（HopStepZ独自）
+static const z80memaddr_t MGS_MSVST = 0x6022;		// MGSDRV のマスターボリューム設定
+static const int DOS_SEGMENTS = 4;					// ページ0～3に割り付けてあり、DOSが使用しているセグメントの数
+
+CZ80MsxDos::CZ80MsxDos() :
+	m_FrameSched(FRAME_TIME_NS)
 {
 	m_pMemSys = nullptr;
 	m_pIoSys = nullptr;
-	setup();
+	m_pMapper = nullptr;
+	m_MgsWorkAddr = 0x0000;
+	m_bMgsWorkValid = false;
+	m_bMgsPlaying = false;
+	m_bSongEnd = false;
+	m_MgsLoopCount = 0xff;
+	m_MgsVolume = 15;
+	m_FrameCount = 0;
+	m_bHeadless = false;
+	m_pLoopDetector = nullptr;
+	m_pProfiler = nullptr;
+	m_pPipeline = nullptr;
+	m_InstCount = 0;
+	m_pTrace = nullptr;
+	m_VsyncPeriod = 0;
+	m_NextVsync = 0;
+	m_bInVsync = false;
+	clearNotBusyLoop();
 	ResetCpu();
 	return;
 }
@@ -25,6 +53,7 @@ void CZ80MsxDos::ResetCpu()
 {
 	m_bHalt = false;
 	m_bIFF1 = m_bIFF2 = false;
+	m_bEiDelay = false;
 	m_IM = INTERRUPTMODE0;
 	m_R.Reset();
 	return;
@@ -34,10 +63,21 @@ void CZ80MsxDos::ResetCpu(const z80memaddr_t pc, const z80memaddr_t sp)
 {
 	m_bHalt = false;
 	m_bIFF1 = m_bIFF2 = false;
+	m_bEiDelay = false;
 	m_IM = INTERRUPTMODE0;
 	m_R.Reset();
 	m_R.PC = pc;
 	m_R.SP = sp;
+	m_bMgsWorkValid = false;
+	m_bMgsPlaying = false;
+	m_bSongEnd = false;
+	m_FrameCount = 0;
+	m_NextVsync = m_Clock.GetTStates() + m_VsyncPeriod;
+	m_bInVsync = false;
+	clearNotBusyLoop();
+	ResetFrameTiming();
+	if( m_pLoopDetector != nullptr )
+		m_pLoopDetector->Reset();
 	return;
 }
 
@@ -66,6 +106,153 @@ z80memaddr_t CZ80MsxDos::GetSP() const
 	return m_R.SP;
 }
 
+/** PLAYER.COM が MGS_PLYST に渡すループ回数を設定する（0xFF=無限）
+ */
+void CZ80MsxDos::SetMgsLoopCount(const uint8_t cnt)
+{
+	m_MgsLoopCount = cnt;
+	return;
+}
+
+/** PLAYER.COM は初期化で音量を最大にするので、演奏を始める前にこの音量に設定し直す
+ * @param vol 0(無音)～15(最大)
+ */
+void CZ80MsxDos::SetMgsVolume(const int vol)
+{
+	m_MgsVolume = vol;
+	return;
+}
+
+/** MGS_MSVST を呼んで、MGSDRV のマスターボリュームを設定する（レジスタは壊さない）
+ * @param vol 0(無音)～15(最大)
+ */
+void CZ80MsxDos::CallMgsMasterVolume(const int vol)
+{
+	const uint8_t a = m_R.A, b = m_R.B;
+	m_R.A = static_cast<uint8_t>(15 - vol);
+	m_R.B = 0;
+	CallSubroutine(MGS_MSVST);
+	m_R.A = a, m_R.B = b;
+	return;
+}
+
+/** MGSDRVが演奏を終えたか
+ */
+bool CZ80MsxDos::IsSongEnd() const
+{
+	return m_bSongEnd;
+}
+
+/** WT16MS が呼ばれた回数
+ */
+uint32_t CZ80MsxDos::GetFrameCount() const
+{
+	return m_FrameCount;
+}
+
+/** これまでに実行した命令数
+ */
+uint64_t CZ80MsxDos::GetInstCount() const
+{
+	return m_InstCount;
+}
+
+/** true にすると WT16MS で 16.6ms 経過を待たずに、すぐに次のフレームを実行する
+ */
+void CZ80MsxDos::SetHeadless(const bool bHeadless)
+{
+	// 待ち合わせを再開するときは、次の ST16MS を基点にし直す
+	if( m_bHeadless != bHeadless )
+		ResetFrameTiming();
+	m_bHeadless = bHeadless;
+	return;
+}
+
+/** 次の ST16MS からフレームの待ち合わせをやり直す（一時停止から再開するときなど）
+ */
+void CZ80MsxDos::ResetFrameTiming()
+{
+	m_FrameSched.Stop();
+	if( m_pProfiler != nullptr )
+		m_pProfiler->Cancel();
+	if( m_pPipeline != nullptr )
+		m_pPipeline->ResetTiming();
+	return;
+}
+
+/** ST16MS～WT16MS の区間の処理時間を測る
+ */
+void CZ80MsxDos::SetProfiler(CFrameProfiler *pProfiler)
+{
+	m_pProfiler = pProfiler;
+	return;
+}
+
+/** 先読みする場合は、フレームの期限を待つのは pPipeline の出力スレッドに任せる
+ */
+void CZ80MsxDos::SetChipPipeline(CChipPipeline *pPipeline)
+{
+	m_pPipeline = pPipeline;
+	return;
+}
+
+/** 命令ごとの実行記録を取る（nullptr=取らない）
+ */
+void CZ80MsxDos::SetTrace(CZ80Trace *pTrace)
+{
+	m_pTrace = pTrace;
+	return;
+}
+
+/** HALT（または自分自身へのジャンプ）で止まっていて、割り込みでも抜け出せない
+ */
+bool CZ80MsxDos::IsStalled() const
+{
+	return m_bHalt && (m_VsyncPeriod == 0 || !m_bIFF1 || m_bInVsync);
+}
+
+/** VSYNC割り込みを period Tステートごとに発生させる（0=発生させない）
+ * 割り込みは H.TIMI を呼び、H.TIMI から戻るごとに１フレームとして数える
+ */
+void CZ80MsxDos::SetVsyncInterrupt(const uint32_t period)
+{
+	m_VsyncPeriod = period;
+	m_NextVsync = m_Clock.GetTStates() + period;
+	return;
+}
+
+/** システムタイマー(E6h/E7h)などが使う時刻
+ */
+CMsxClock *CZ80MsxDos::GetClock()
+{
+	return &m_Clock;
+}
+
+/** フレームの周期を変える（演奏の速さを変えるとき）
+ */
+void CZ80MsxDos::SetFramePeriod(const int64_t periodNs)
+{
+	m_FrameSched.SetPeriod(periodNs);
+	if( m_pPipeline != nullptr )
+		m_pPipeline->SetFramePeriod(periodNs);
+	return;
+}
+
+/** フレームの待ち合わせの統計
+ */
+const CFrameScheduler::STATS &CZ80MsxDos::GetFrameStats() const
+{
+	return m_FrameSched.GetStats();
+}
+
+/** MGS_INTER の呼び出しごとに、ループ検出にフレームを通知する
+ */
+void CZ80MsxDos::SetLoopDetector(CLoopDetector *pDetector)
+{
+	m_pLoopDetector = pDetector;
+	return;
+}
+
 void CZ80MsxDos::SetSubSystem(
 	CMsxMemSlotSystem *pMem, CMsxIoSystem *pIo)
 {
@@ -74,10 +261,31 @@ void CZ80MsxDos::SetSubSystem(
 	return;
 }
 
+/** プライマリマッパの装置を指定して、セグメントの割り当て表を作る
+ * MemoryMapper[]の要素番号そのものがセグメント番号を示し、
+ * 中の値は、割り当て済みかどうかを示している。0=未割当、1=ユーザー、2=システム
+ */
+void CZ80MsxDos::SetMemoryMapper(CMsxMemoryMapper *pMapper)
+{
+	m_pMapper = pMapper;
+	// EXTBIO で返すセグメント数は 8bit なので、割り当てるのは 255 セグメントまで
+	const int num = std::min(pMapper->GetNumSegments(), 0xff);
+	m_MemoryMapper.assign(num, 0);
+	// セグメント0～3はページ0～3に割り付けてあり、DOSが使用しているとする
+	for( int t = 0; t < DOS_SEGMENTS; ++t )
+		m_MemoryMapper[t] = 2;
+	// 番号の小さいセグメントから割り当てるよう、大きい順に積んでおく
+	m_FreeSegments.clear();
+	for( int t = num-1; DOS_SEGMENTS <= t; --t )
+		m_FreeSegments.push_back(static_cast<uint8_t>(t));
+	return;
+}
+
 void CZ80MsxDos::Execution()
 {
 	OpCodeMachine();
-//	InterruptMachine();
+	if( m_VsyncPeriod != 0 )
+		InterruptMachine();
 	BiosFunctionCall();
 	MsxDosFunctionCall();
 	ExtendedBiosFunctionCall();
@@ -85,42 +293,234 @@ void CZ80MsxDos::Execution()
 	return;
 }
 
-void CZ80MsxDos::OpCodeMachine()
+/** 分岐しても自分以外の状態が変わらない命令（JR/JP とその条件付き、JP (HL)）
+ */
+static bool isPlainJump(const uint8_t code)
 {
-#if !defined(NDEBUG)
-	m_PcHist.push_back(m_R);
-#endif
+	switch(code)
+	{
+		case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA:
+		case 0xE2: case 0xE9: case 0xEA: case 0xF2: case 0xFA:
+			return true;
+		default:
+			return false;
+	}
+}
 
+void CZ80MsxDos::OpCodeMachine()
+{
 	assert(m_pMemSys != nullptr);
 	assert(m_pIoSys != nullptr);
 
 	if( !m_bHalt ) {
 		m_R.CodePC = m_R.PC++;
 		m_R.Code = m_pMemSys->Read(m_R.CodePC);
+		if( m_pTrace != nullptr )
+			recordTrace();
+		m_Clock.AddTStates(Z80TS_MAIN[m_R.Code]);
 		auto pFunc = OpCode_Single[m_R.Code].pFunc;
 		(this->*pFunc)();
+		++m_InstCount;
+		// 後ろへの分岐（ループ）のときだけ、空回りしていないかを調べる
+		if( m_R.PC <= m_R.CodePC )
+			checkIdleLoop();
+	}
+	else if( m_VsyncPeriod != 0 && m_bIFF1 && m_Clock.GetTStates() < m_NextVsync ){
+		// 割り込みを待っている HALT は、次の割り込みの時刻まで一度に進める
+		m_Clock.AddTStates(static_cast<uint32_t>(m_NextVsync - m_Clock.GetTStates()));
+	}
+	else{
+		m_Clock.AddTStates(Z80TS_HALT);
 	}
 	return;
 }
 
-void CZ80MsxDos::InterruptMachine()
+/** 実行する直前の状態を記録する
+ */
+void CZ80MsxDos::recordTrace()
+{
+	Z80TRACERECORD r;
+	r.TStates = m_Clock.GetTStates();
+	r.InstNo = static_cast<uint32_t>(m_InstCount);
+	r.PC = m_R.CodePC;
+	r.SP = m_R.SP;
+	r.AF = m_R.GetAF();
+	r.BC = m_R.GetBC();
+	r.DE = m_R.GetDE();
+	r.HL = m_R.GetHL();
+	r.IX = m_R.IX;
+	r.IY = m_R.IY;
+	r.Code[0] = m_R.Code;
+	for( int t = 1; t < 4; ++t )
+		r.Code[t] = m_pMemSys->Read(static_cast<z80memaddr_t>(m_R.CodePC + t));
+	m_pTrace->Record(r);
+	return;
+}
+
+/** 待ちループではなかった分岐命令の記録を消す（プログラムを読み込み直したとき）
+ */
+void CZ80MsxDos::clearNotBusyLoop()
 {
-	uint32_t VSYNC = 16600;			// 16.6ms
-	if( m_Tim.GetTime() <= VSYNC )
-		return;
-	m_Tim.ResetBegin();
+	for( int t = 0; t < NOT_BUSY_LOOP_NUM; ++t )
+		m_NotBusyLoopPC[t] = UINT32_MAX;
+	return;
+}
 
-	if( !m_bIFF1 )
+/** 空回りしているループを見つけて、実行せずに時刻を進める
+ */
+void CZ80MsxDos::checkIdleLoop()
+{
+	if( m_R.PC == m_R.CodePC ){
+		// DJNZ $ は B が 0 になるまで飛ばす
+		if( m_R.Code == 0x10 )
+			skipBusyLoop();
+		// 自分自身へのジャンプ（JR $ など）は、割り込みが来るまで何も変わらないので HALT と同じに扱う
+		else if( isPlainJump(m_R.Code) )
+			m_bHalt = true;
 		return;
-	// H.TIMI の呼び出し
-	Push16(m_R.PC);
-	m_R.PC = 0xFD9F;
+	}
+	uint32_t &notBusy = m_NotBusyLoopPC[m_R.CodePC % NOT_BUSY_LOOP_NUM];
+	if( notBusy == m_R.CodePC )
+		return;
+	if( !skipBusyLoop() )
+		notBusy = m_R.CodePC;
+	return;
+}
+
+/** 次の割り込みまでのTステート数（割り込みが起きない間は UINT64_MAX）
+ */
+uint64_t CZ80MsxDos::getTStatesToInterrupt() const
+{
+	if( m_VsyncPeriod == 0 || !m_bIFF1 || m_bInVsync )
+		return UINT64_MAX;
+	const uint64_t now = m_Clock.GetTStates();
+	return (now < m_NextVsync) ? (m_NextVsync - now) : 0;
+}
+
+/** 数命令だけの、副作用の無い待ちループを計算で飛ばす
+ * 分岐してループの先頭に戻った時点で呼ばれる。最後の１周は普通に実行させるので、抜けたときのフラグなどはそのまま正しい。
+ *   DJNZ $								: B が 0 になるまで
+ *   DEC r / JR NZ,loop					: r が 0 になるまで
+ *   DEC rr / LD A,r / OR r / JR NZ,loop	: rr が 0 になるまで
+ *   IN A,(E6h|E7h) / CP n / JR C,loop	: システムタイマーが n 以上になるまで（仮想時刻のときだけ）
+ * 割り込みが起きる場合は、割り込みの時刻を越えない分だけ飛ばす。
+ * @return ループの形が当てはまらなかった場合は false
+ */
+bool CZ80MsxDos::skipBusyLoop()
+{
+	const z80memaddr_t top = m_R.PC;
+	const int len = m_R.CodePC - top;			// 分岐命令より前の命令のバイト数
+	uint8_t b[6];
+	if( static_cast<int>(sizeof(b)) < len )
+		return false;
+	for( int t = 0; t < len; ++t )
+		b[t] = m_pMemSys->Read(top + t);
+
+	uint64_t count = 0;		// あと何周、ループの先頭から実行するか
+	uint32_t cost;			// 分岐して戻るまでの１周分のTステート数
+	uint8_t *pReg8 = nullptr;
+	uint8_t *pHi = nullptr, *pLo = nullptr;
+	if( m_R.Code == 0x10 && len == 0 ){
+		// DJNZ $
+		pReg8 = &m_R.B;
+		cost = Z80TS_MAIN[0x10] + Z80TS_JR_TAKEN;
+	}
+	else if( m_R.Code == 0x20 && len == 1 && (b[0] & 0xC7) == 0x05 && b[0] != 0x35 ){
+		// DEC r / JR NZ,loop
+		uint8_t *regs[] = { &m_R.B, &m_R.C, &m_R.D, &m_R.E, &m_R.H, &m_R.L, nullptr, &m_R.A };
+		pReg8 = regs[(b[0]>>3) & 0x07];
+		cost = Z80TS_MAIN[b[0]] + Z80TS_MAIN[0x20] + Z80TS_JR_TAKEN;
+	}
+	else if( m_R.Code == 0x20 && len == 3 && (b[0] == 0x0B || b[0] == 0x1B || b[0] == 0x2B) ){
+		// DEC rr / LD A,hi / OR lo / JR NZ,loop（LD A,lo / OR hi でもよい）
+		uint8_t *regs[][2] = { { &m_R.B, &m_R.C }, { &m_R.D, &m_R.E }, { &m_R.H, &m_R.L } };
+		const int no = (b[0]>>4) & 0x03;
+		pHi = regs[no][0], pLo = regs[no][1];
+		const uint8_t ldHi = static_cast<uint8_t>(0x78 + no*2), ldLo = static_cast<uint8_t>(ldHi + 1);
+		const uint8_t orHi = static_cast<uint8_t>(0xB0 + no*2), orLo = static_cast<uint8_t>(orHi + 1);
+		if( !((b[1] == ldHi && b[2] == orLo) || (b[1] == ldLo && b[2] == orHi)) )
+			return false;
+		cost = Z80TS_MAIN[b[0]] + Z80TS_MAIN[b[1]] + Z80TS_MAIN[b[2]] + Z80TS_MAIN[0x20] + Z80TS_JR_TAKEN;
+	}
+	else if( m_R.Code == 0x38 && len == 4 && b[0] == 0xDB && (b[1] == 0xE6 || b[1] == 0xE7) && b[2] == 0xFE ){
+		// IN A,(E6h|E7h) / CP n / JR C,loop
+		if( m_Clock.GetMode() != CMsxClock::MODE_VIRTUAL )
+			return true;		// 実時間では本当に待つしかない
+		cost = Z80TS_MAIN[0xDB] + Z80TS_MAIN[0xFE] + Z80TS_MAIN[0x38] + Z80TS_JR_TAKEN;
+		// タイマーが n になる時刻までの周回数
+		const uint16_t timer = m_pIoSys->GetSystemTimer();
+		const uint8_t v = (b[1] == 0xE6) ? (timer & 0xff) : (timer >> 8);
+		if( b[3] <= v )
+			return true;		// 次の周で抜ける
+		const uint16_t target = (b[1] == 0xE6)
+			? static_cast<uint16_t>((timer & 0xFF00) | b[3])
+			: static_cast<uint16_t>(b[3] << 8);
+		const uint64_t ts = m_Clock.MicrosecondsToTStates(m_pIoSys->GetSystemTimerTime(target));
+		const uint64_t now = m_Clock.GetTStates();
+		count = (now < ts) ? (ts - now) / cost : 0;
+	}
+	else{
+		return false;
+	}
+
+	if( pReg8 != nullptr )
+		count = (*pReg8 == 0) ? 256 : *pReg8;
+	else if( pHi != nullptr ){
+		count = (static_cast<uint32_t>(*pHi) << 8) | *pLo;
+		if( count == 0 )
+			count = 0x10000;
+	}
+	// 最後の１周は実行させる
+	uint64_t skip = (0 < count) ? count - 1 : 0;
+	const uint64_t toInt = getTStatesToInterrupt();
+	if( toInt != UINT64_MAX && toInt / cost < skip )
+		skip = toInt / cost;
+	if( skip == 0 )
+		return true;
 
-	op_DI();
+	m_Clock.AddTStates(static_cast<uint32_t>(skip * cost));
+	if( pReg8 != nullptr )
+		*pReg8 = static_cast<uint8_t>(*pReg8 - skip);
+	else if( pHi != nullptr ){
+		const uint16_t v = static_cast<uint16_t>(((*pHi << 8) | *pLo) - skip);
+		*pHi = static_cast<uint8_t>(v >> 8);
+		*pLo = static_cast<uint8_t>(v & 0xff);
+	}
+	return true;
+}
 
-	// カウントアップ
-	uint16_t v = m_pMemSys->ReadWord(0xFC9E);
-	m_pMemSys->WriteWord(0xFC9E, ++v);
+/** VSYNC割り込み
+ * 前回の割り込みから m_VsyncPeriod Tステート経過していたら割り込みを受け付ける。
+ * 割り込み禁止の間は受け付けずに保留し、EI されたら受け付ける（VDPが割り込み要求を出し続けるのと同じ）。
+ * 実機と同じく、EI の次の命令を実行し終えるまでは受け付けない。
+ * IM0/IM1 は RST 38h、IM2 は I レジスタとデータバスの値(MSXでは FFh)で作ったアドレスのベクタへ分岐する。
+ */
+void CZ80MsxDos::InterruptMachine()
+{
+	if( m_bEiDelay ){
+		m_bEiDelay = false;
+		return;
+	}
+	if( m_Clock.GetTStates() < m_NextVsync )
+		return;
+	if( !m_bIFF1 || m_bInVsync )
+		return;
+	m_NextVsync += m_VsyncPeriod;
+	if( m_NextVsync <= m_Clock.GetTStates() )
+		m_NextVsync = m_Clock.GetTStates() + m_VsyncPeriod;	// 遅れすぎたら基点を取り直す
+	m_bHalt = false;
+	m_bIFF1 = m_bIFF2 = false;
+	Push16(m_R.PC);
+	if( m_IM == INTERRUPTMODE2 ){
+		const z80memaddr_t vector = static_cast<z80memaddr_t>((m_R.I << 8) | 0xFF);
+		m_R.PC = static_cast<z80memaddr_t>(m_pMemSys->Read(vector) | (m_pMemSys->Read(vector + 1) << 8));
+		m_Clock.AddTStates(Z80TS_INT_IM2);
+	}
+	else{
+		m_R.PC = 0x0038;
+		m_Clock.AddTStates(Z80TS_INT_IM1);
+	}
 	return;
 }
 
@@ -133,6 +533,16 @@ const static z80memaddr_t BIOS_CALLF 		= 0x0030;	// 別のスロットにある
 const static z80memaddr_t BIOS_KEYINT 		= 0x0038;	// タイマ割り込みの処理ルーチンを実行します。
 const static z80memaddr_t BIOS_HSZ_ST16MS	= 0x0039;	// (HopStepZオリジナル)16msウェイトの基点
 const static z80memaddr_t BIOS_HSZ_WT16MS	= 0x003A;	// (HopStepZオリジナル)16ms経過まで待つ
+const static z80memaddr_t BIOS_HSZ_MGSWK	= 0x003B;	// (HopStepZオリジナル)IX=MGSDRVのワークエリアを教えてもらう
+const static z80memaddr_t BIOS_HSZ_LOOPCT	= 0x003C;	// (HopStepZオリジナル)B=MGS_PLYSTに渡すループ回数を返す
+const static z80memaddr_t BIOS_HSZ_HOSTRET	= 0x003D;	// (HopStepZオリジナル)CallSubroutine()の戻り先
+const static z80memaddr_t BIOS_HSZ_INTRET	= 0x003E;	// (HopStepZオリジナル)KEYINTから呼んだH.TIMIの戻り先
+const static z80memaddr_t BIOS_H_TIMI		= 0xFD9F;	// タイマ割り込みのフック
+const static z80memaddr_t BIOS_JIFFY		= 0xFC9E;	// タイマ割り込みごとに増えるカウンタ
+
+// MGSDRV のワークエリア(MGS_SYSCKが返すIX)内のオフセット
+const static int MGSWK_LOOPCT				= 5;		// ループした回数
+const static int MGSWK_PLAYFG				= 8;		// 演奏中フラグ(0=停止)
 
 const static z80memaddr_t DOS_SYSTEMCALL	= 0x0005;	// DOSシステムコール
 const static dosfuncno_t  DOS_CONOUT		= 0x02;		// コンソールへ 1 文字出力
@@ -152,22 +562,39 @@ void CZ80MsxDos::BiosFunctionCall()
 	{
 		case BIOS_HSZ_ST16MS:
 		{
-			m_Tim16ms.ResetBegin();
+			beginFrame();
 			op_RET();
 			break;
 		}
 		case BIOS_HSZ_WT16MS:
 		{
-			static const uint64_t VSYNCTIME = 16600;	// 16.6ms
-			auto et = m_Tim16ms.GetTime();
-			if( et < VSYNCTIME ){
-				auto def = VSYNCTIME - et;
-				std::this_thread::sleep_for(std::chrono::microseconds(def));
-			}
-			m_Tim16ms.ResetBegin();
+			endFrame();
+			m_Clock.EndFrame();
+			op_RET();
+			break;
+		}
+		case BIOS_HSZ_MGSWK:
+		{
+			m_MgsWorkAddr = m_R.IX;
+			m_bMgsWorkValid = true;
+			// ループ回数はループごとに変わるので、ループ検出のハッシュには含めない
+			if( m_pLoopDetector != nullptr )
+				m_pLoopDetector->SetIgnoreKey(CLoopDetector::KEY_MEMORY + m_MgsWorkAddr + MGSWK_LOOPCT);
+			op_RET();
+			break;
+		}
+		case BIOS_HSZ_LOOPCT:
+		{
+			// PLAYER.COM は直前に MGS_MSVST で音量を最大にしている
+			if( m_MgsVolume != 15 )
+				CallMgsMasterVolume(m_MgsVolume);
+			m_R.B = m_MgsLoopCount;
 			op_RET();
 			break;
 		}
+		case BIOS_HSZ_HOSTRET:
+			// CallSubroutine() が処理する
+			break;
 		case BIOS_RDSLT:
 		{
 			auto pageNo = static_cast<MEMPAGENO>(m_R.GetHL()/Z80_PAGE_SIZE);
@@ -226,7 +653,30 @@ void CZ80MsxDos::BiosFunctionCall()
 		}
 		case BIOS_KEYINT:
 		{
+			if( m_VsyncPeriod == 0 ){
+				op_RET();
+				break;
+			}
+			// H.TIMI を呼ぶ。H.TIMI はレジスタを壊してよいので、戻ってきたら(BIOS_HSZ_INTRET)元に戻す
+			beginFrame();
+			m_IntRegs = m_R;
+			m_bInVsync = true;
+			m_R.A = 0x80;		// VDPのステータスレジスタ#0（F=1）
+			Push16(BIOS_HSZ_INTRET);
+			m_R.PC = BIOS_H_TIMI;
+			break;
+		}
+		case BIOS_HSZ_INTRET:
+		{
+			m_R = m_IntRegs;
+			m_bInVsync = false;
+			uint16_t v = m_pMemSys->ReadWord(BIOS_JIFFY);
+			m_pMemSys->WriteWord(BIOS_JIFFY, ++v);
+			endFrame();
+			// H.TIMI の後の EI / RET までを済ませたので、すぐに次の割り込みを受け付けてよい
+			m_bIFF1 = m_bIFF2 = true;
 			op_RET();
+			break;
 		}
 		
 		// do nothing
@@ -247,6 +697,86 @@ void CZ80MsxDos::BiosFunctionCall()
 	return;
 }
 
+/** フレームの始まり（ST16MS、VSYNC割り込みの受け付け）
+ */
+void CZ80MsxDos::beginFrame()
+{
+	// 最初のフレームの開始時刻を基点にし、以降は endFrame() が基点からの絶対時刻で待つ
+	if( !m_bHeadless && !m_FrameSched.IsStarted() )
+		m_FrameSched.Start();
+	if( !m_bHeadless && m_pProfiler != nullptr )
+		m_pProfiler->BeginFrame(m_InstCount);
+	return;
+}
+
+/** フレームの終わり（WT16MS、H.TIMI からの戻り）
+ * 次のフレームの時刻まで待ち、曲の終わりとループを調べる
+ */
+void CZ80MsxDos::endFrame()
+{
+	if( !m_bHeadless ){
+		if( m_pProfiler != nullptr )
+			m_pProfiler->EndEmulation(m_InstCount);
+		if( m_pPipeline != nullptr && m_pPipeline->IsPipelined() ){
+			// 書き込みをフレームとして区切って、出力スレッドに渡す
+			m_pPipeline->EndFrame();
+		}
+		else{
+			// 前フレームからの相対時間で sleep すると誤差が積み重なるので、基点からの絶対時刻で待つ
+			if( m_pProfiler != nullptr ){
+				m_pProfiler->RecordChips();
+				m_pProfiler->BeginWait();
+			}
+			const int64_t requested = m_FrameSched.WaitNextFrame();
+			if( m_pProfiler != nullptr )
+				m_pProfiler->EndWait(requested);
+			if( m_pPipeline != nullptr )
+				m_pPipeline->SetOverloaded(m_FrameSched.IsOverloaded());
+		}
+	}
+	++m_FrameCount;
+	if( m_bMgsWorkValid ){
+		// 演奏中フラグが一度立ってから落ちたら、曲の終わりとする
+		bool bPlay = (m_pMemSys->Read(m_MgsWorkAddr + MGSWK_PLAYFG) != 0);
+		if( m_bMgsPlaying && !bPlay )
+			m_bSongEnd = true;
+		m_bMgsPlaying = bPlay;
+	}
+	if( m_pLoopDetector != nullptr && m_bMgsPlaying )
+		m_pLoopDetector->Frame(m_FrameCount);
+	return;
+}
+
+/** MGSDRV がループした回数（MGSDRVのワークエリアがわからない間は 0）
+ */
+uint8_t CZ80MsxDos::GetMgsLoopCounter() const
+{
+	if( !m_bMgsWorkValid )
+		return 0;
+	return m_pMemSys->Read(m_MgsWorkAddr + MGSWK_LOOPCT);
+}
+
+/** Z80のサブルーチンをホスト側から呼び出し、戻ってくるまで実行する
+ * 呼び出し前のレジスタ(PC,SPを含む)は、戻ってきた後に元に戻す。引数のレジスタは呼び出し側で設定しておくこと。
+ */
+void CZ80MsxDos::CallSubroutine(const z80memaddr_t addr)
+{
+	CZ80Regs saved = m_R;
+	const bool bHalt = m_bHalt;
+	const bool bIFF1 = m_bIFF1, bIFF2 = m_bIFF2, bEiDelay = m_bEiDelay;
+	m_bHalt = false;
+	m_bIFF1 = m_bIFF2 = false;		// ホストからの呼び出し中は割り込ませない
+	Push16(BIOS_HSZ_HOSTRET);
+	m_R.PC = addr;
+	while( m_R.PC != BIOS_HSZ_HOSTRET && m_R.PC != 0 && !IsStalled() )
+		Execution();
+	m_R = saved;
+	m_bHalt = bHalt;
+	m_bIFF1 = bIFF1, m_bIFF2 = bIFF2;
+	m_bEiDelay = bEiDelay;
+	return;
+}
+
 /** 拡張BIOS（メモリマッパ）
  * @note
  * PCの値を見張っていて、特定の位置にPCが来たら対応するファンクションを実行する
@@ -254,22 +784,22 @@ void CZ80MsxDos::BiosFunctionCall()
 */
 void CZ80MsxDos::ExtendedBiosFunctionCall()
 {
-static const z80memaddr_t MM_ALL_SEG 	= 0xFF01;	// 16Kのセグメントを割り付ける
-static const z80memaddr_t MM_FRE_SEG 	= 0xFF02;	// 16Kのセグメントを開放する
-static const z80memaddr_t MM_RD_SEG		= 0xFF03;	// セグメント番号Ａの番地ＨＬの内容を読む
-static const z80memaddr_t MM_WR_SEG		= 0xFF04;	// セグメント番号Ａの番地ＨＬにＥの値を書く
-static const z80memaddr_t MM_CAL_SEG	= 0xFF05;	// インターセグメントコール（インデックスレジスタ）
-static const z80memaddr_t MM_CALLS		= 0xFF06;	// インターセグメントコール（インラインパラメーター）
-static const z80memaddr_t MM_PUT_PH		= 0xFF07;	// Ｈレジスタの上位２ビットのページを切り換える
-static const z80memaddr_t MM_GET_PH		= 0xFF08;	// Ｈレジスタの上位２ビットのページのセグメント番号を得る
-static const z80memaddr_t MM_PUT_P0		= 0xFF09;	// ページ０のセグメントを切り換える
-static const z80memaddr_t MM_GET_P0		= 0xFF0A;	// ページ０の現在のセグメント番号を得る
-static const z80memaddr_t MM_PUT_P1		= 0xFF0B;	// ページ１のセグメントを切り換える
-static const z80memaddr_t MM_GET_P1		= 0xFF0C;	// ページ１の現在のセグメント番号を得る
-static const z80memaddr_t MM_PUT_P2		= 0xFF0D;	// ページ２のセグメントを切り換える
-static const z80memaddr_t MM_GET_P2		= 0xFF0E;	// ページ２の現在のセグメント番号を得る
-static const z80memaddr_t MM_PUT_P3		= 0xFF0F;	// 何もせずに戻る
-static const z80memaddr_t MM_GET_P3		= 0xFF10;	// ページ３の現在のセグメント番号を得る
+static const z80memaddr_t MM_ALL_SEG 	= 0xFF00;	// 16Kのセグメントを割り付ける
+static const z80memaddr_t MM_FRE_SEG 	= 0xFF03;	// 16Kのセグメントを開放する
+static const z80memaddr_t MM_RD_SEG		= 0xFF06;	// セグメント番号Ａの番地ＨＬの内容を読む
+static const z80memaddr_t MM_WR_SEG		= 0xFF09;	// セグメント番号Ａの番地ＨＬにＥの値を書く
+static const z80memaddr_t MM_CAL_SEG	= 0xFF0C;	// インターセグメントコール（インデックスレジスタ）
+static const z80memaddr_t MM_CALLS		= 0xFF0F;	// インターセグメントコール（インラインパラメーター）
+static const z80memaddr_t MM_PUT_PH		= 0xFF12;	// Ｈレジスタの上位２ビットのページを切り換える
+static const z80memaddr_t MM_GET_PH		= 0xFF15;	// Ｈレジスタの上位２ビットのページのセグメント番号を得る
+static const z80memaddr_t MM_PUT_P0		= 0xFF18;	// ページ０のセグメントを切り換える
+static const z80memaddr_t MM_GET_P0		= 0xFF1B;	// ページ０の現在のセグメント番号を得る
+static const z80memaddr_t MM_PUT_P1		= 0xFF1E;	// ページ１のセグメントを切り換える
+static const z80memaddr_t MM_GET_P1		= 0xFF21;	// ページ１の現在のセグメント番号を得る
+static const z80memaddr_t MM_PUT_P2		= 0xFF24;	// ページ２のセグメントを切り換える
+static const z80memaddr_t MM_GET_P2		= 0xFF27;	// ページ２の現在のセグメント番号を得る
+static const z80memaddr_t MM_PUT_P3		= 0xFF2A;	// 何もせずに戻る
+static const z80memaddr_t MM_GET_P3		= 0xFF2D;	// ページ３の現在のセグメント番号を得る
 const static z80memaddr_t BIOS_EXTBIO 	= 0xFFCA;	// 拡張BIOS
 
 	if( m_R.PC < MM_ALL_SEG )
@@ -280,74 +810,75 @@ const static z80memaddr_t BIOS_EXTBIO 	= 0xFFCA;	// 拡張BIOS
 		{
 			if( m_R.GetDE() == 0x0402 ){
 				// マッパサポートルーチンの先頭アドレスを得る
-				m_R.A = 16;			// CRam256k プライマリマッパの総セグメント数、
+				m_R.A = static_cast<uint8_t>(m_MemoryMapper.size());	// プライマリマッパの総セグメント数、
 				m_R.B = SLOTNO_3;	// プライマリマッパのスロット番号、
-				m_R.C = 16-4;		// Cにプライマリマッパの未使用セグメント数、(4つは既にDOSが使用しているとする）
+				m_R.C = static_cast<uint8_t>(getNumFreeSegments());	// Cにプライマリマッパの未使用セグメント数
 				m_R.SetHL(0xFF00);	// HLにジャンプテーブルの先頭アドレスを返す。（仮に0xFF00と定めた）
-				// 
+				// 各エントリにPCが来たところで処理する。テーブルを複製して使うプログラムのために、
+				// エントリには自分自身へのジャンプを置いておく。
 				//  +0H　ALL_SEG　　 16Kのセグメントを割り付ける
 				m_pMemSys->Write(0xFF00+ 0, 0xC3);
-				m_pMemSys->Write(0xFF00+ 1, 0x01);
+				m_pMemSys->Write(0xFF00+ 1, 0x00);
 				m_pMemSys->Write(0xFF00+ 2, 0xFF);
 				//  +3H　FRE_SEG　　 16Kのセグメントを開放する
 				m_pMemSys->Write(0xFF00+ 3, 0xC3);
-				m_pMemSys->Write(0xFF00+ 4, 0x02);
+				m_pMemSys->Write(0xFF00+ 4, 0x03);
 				m_pMemSys->Write(0xFF00+ 5, 0xFF);
 				//  +6H　RD_SEG　　　セグメント番号Ａの番地ＨＬの内容を読む
 				m_pMemSys->Write(0xFF00+ 6, 0xC3);
-				m_pMemSys->Write(0xFF00+ 7, 0x03);
+				m_pMemSys->Write(0xFF00+ 7, 0x06);
 				m_pMemSys->Write(0xFF00+ 8, 0xFF);
 				//  +9H　WR_SEG　　　セグメント番号Ａの番地ＨＬにＥの値を書く
 				m_pMemSys->Write(0xFF00+ 9, 0xC3);
-				m_pMemSys->Write(0xFF00+10, 0x04);
+				m_pMemSys->Write(0xFF00+10, 0x09);
 				m_pMemSys->Write(0xFF00+11, 0xFF);
 				//  +CH　CAL_SEG　　 インターセグメントコール（インデックスレジスタ）
 				m_pMemSys->Write(0xFF00+12, 0xC3);
-				m_pMemSys->Write(0xFF00+13, 0x05);
+				m_pMemSys->Write(0xFF00+13, 0x0C);
 				m_pMemSys->Write(0xFF00+14, 0xFF);
 				//  +FH　CALLS　　　 インターセグメントコール（インラインパラメーター）
 				m_pMemSys->Write(0xFF00+15, 0xC3);
-				m_pMemSys->Write(0xFF00+16, 0x06);
+				m_pMemSys->Write(0xFF00+16, 0x0F);
 				m_pMemSys->Write(0xFF00+17, 0xFF);
 				// +12H　PUT_PH　　　Ｈレジスタの上位２ビットのページを切り換える
 				m_pMemSys->Write(0xFF00+18, 0xC3);
-				m_pMemSys->Write(0xFF00+19, 0x07);
+				m_pMemSys->Write(0xFF00+19, 0x12);
 				m_pMemSys->Write(0xFF00+20, 0xFF);
 				// +15H　GET_PH　　　Ｈレジスタの上位２ビットのページのセグメント番号を得る
 				m_pMemSys->Write(0xFF00+21, 0xC3);
-				m_pMemSys->Write(0xFF00+22, 0x08);
+				m_pMemSys->Write(0xFF00+22, 0x15);
 				m_pMemSys->Write(0xFF00+23, 0xFF);
 				// +18H　PUT_P0　　　ページ０のセグメントを切り換える
 				m_pMemSys->Write(0xFF00+24, 0xC3);
-				m_pMemSys->Write(0xFF00+25, 0x09);
+				m_pMemSys->Write(0xFF00+25, 0x18);
 				m_pMemSys->Write(0xFF00+26, 0xFF);
 				// +1BH　GET_P0　　　ページ０の現在のセグメント番号を得る
 				m_pMemSys->Write(0xFF00+27, 0xC3);
-				m_pMemSys->Write(0xFF00+28, 0x0A);
+				m_pMemSys->Write(0xFF00+28, 0x1B);
 				m_pMemSys->Write(0xFF00+29, 0xFF);
 				// +1EH　PUT_P1　　　ページ１のセグメントを切り換える
 				m_pMemSys->Write(0xFF00+30, 0xC3);
-				m_pMemSys->Write(0xFF00+31, 0x0B);
+				m_pMemSys->Write(0xFF00+31, 0x1E);
 				m_pMemSys->Write(0xFF00+32, 0xFF);
 				// +21H　GET_P1　　　ページ１の現在のセグメント番号を得る
 				m_pMemSys->Write(0xFF00+33, 0xC3);
-				m_pMemSys->Write(0xFF00+34, 0x0C);
+				m_pMemSys->Write(0xFF00+34, 0x21);
 				m_pMemSys->Write(0xFF00+35, 0xFF);
 				// +24H　PUT_P2　　　ページ２のセグメントを切り換える
 				m_pMemSys->Write(0xFF00+36, 0xC3);
-				m_pMemSys->Write(0xFF00+37, 0x0D);
+				m_pMemSys->Write(0xFF00+37, 0x24);
 				m_pMemSys->Write(0xFF00+38, 0xFF);
 				// +27H　GET_P2　　　ページ２の現在のセグメント番号を得る
 				m_pMemSys->Write(0xFF00+39, 0xC3);
-				m_pMemSys->Write(0xFF00+40, 0x0E);
+				m_pMemSys->Write(0xFF00+40, 0x27);
 				m_pMemSys->Write(0xFF00+41, 0xFF);
 				// +2AH　PUT_P3　　　何もせずに戻る
 				m_pMemSys->Write(0xFF00+42, 0xC3);
-				m_pMemSys->Write(0xFF00+43, 0x0F);
+				m_pMemSys->Write(0xFF00+43, 0x2A);
 				m_pMemSys->Write(0xFF00+44, 0xFF);
 				// +2DH　GET_P3　　　ページ３の現在のセグメント番号を得る
 				m_pMemSys->Write(0xFF00+45, 0xC3);
-				m_pMemSys->Write(0xFF00+46, 0x10);
+				m_pMemSys->Write(0xFF00+46, 0x2D);
 				m_pMemSys->Write(0xFF00+47, 0xFF);
 			}
 			else if (m_R.GetDE() == 0xf000) {
@@ -364,9 +895,10 @@ const static z80memaddr_t BIOS_EXTBIO 	= 0xFFCA;	// 拡張BIOS
 		}
 		case MM_ALL_SEG:	// 16Kのセグメントを割り付ける
 		{
-			int pageNo;
-			if( patchingMapper(&pageNo, m_R.A+1)) {
-				m_R.A = static_cast<uint8_t>(pageNo);
+			// A=0 ユーザー、1 システム
+			int segNo;
+			if( allocSegment(&segNo, (m_R.A & 0x01) + 1) ) {
+				m_R.A = static_cast<uint8_t>(segNo);
 				m_R.F.C = 0;
 			}
 			else{
@@ -377,33 +909,48 @@ const static z80memaddr_t BIOS_EXTBIO 	= 0xFFCA;	// 拡張BIOS
 		}
 		case MM_FRE_SEG:	// 16Kのセグメントを開放する
 		{
-			m_MemoryMapper[m_R.A] = 0;
-			m_R.F.C = 0;
+			m_R.F.C = freeSegment(m_R.A) ? 0 : 1;
 			op_RET();
 			break;
 		}
 		case MM_RD_SEG:		// セグメント番号Ａの番地ＨＬの内容を読む
-			DEBUG_BREAK;
+			// ページを切り換えずに、セグメントを直接読む
+			m_R.A = m_pMapper->ReadSegment(m_R.A, m_R.GetHL());
 			op_RET();
 			break;
 		case MM_WR_SEG:		// セグメント番号Ａの番地ＨＬにＥの値を書く
-			DEBUG_BREAK;
+			m_pMapper->WriteSegment(m_R.A, m_R.GetHL(), m_R.E);
 			op_RET();
 			break;
 		case MM_CAL_SEG:	// インターセグメントコール（インデックスレジスタ）
-			DEBUG_BREAK;
-			op_RET();
+			// IYの上位バイトがセグメント番号、IXが呼び出すアドレス
+			callSegment(m_R.IY >> 8, m_R.IX);
 			break;
 		case MM_CALLS:		// インターセグメントコール（インラインパラメーター）
-			DEBUG_BREAK;
+		{
+			// CALL CALLS の直後の DB セグメント番号, DW 呼び出すアドレス を読んで、その後ろへ戻る
+			const z80memaddr_t param = Pop16();
+			const uint8_t seg = m_pMemSys->Read(param);
+			const z80memaddr_t addr = m_pMemSys->Read(param+1) | (m_pMemSys->Read(param+2) << 8);
+			Push16(static_cast<uint16_t>(param+3));
+			callSegment(seg, addr);
+			break;
+		}
+		case MM_RET_SEG:	// インターセグメントコールから戻った
+		{
+			// callSegment() で積んだ、呼び出し前のページとセグメント番号を戻す
+			const uint16_t saved = Pop16();
+			m_pIoSys->Out(0xFC + (saved >> 8), saved & 0xff);
 			op_RET();
 			break;
-		case MM_PUT_PH:		// Ｈレジスタの上位２ビットのページを切り換える
-			DEBUG_BREAK;
+		}
+		case MM_PUT_PH:		// Ｈレジスタの上位２ビットのページを切り換える（ページ３は切り換えない）
+			if( (m_R.H >> 6) != 3 )
+				m_pIoSys->Out(0xFC + (m_R.H >> 6), m_R.A);
 			op_RET();
 			break;
 		case MM_GET_PH:		// Ｈレジスタの上位２ビットのページのセグメント番号を得る
-			DEBUG_BREAK;
+			m_R.A = m_pIoSys->In(0xFC + (m_R.H >> 6));
 			op_RET();
 			break;
 		case MM_PUT_P0:		// ページ０のセグメントを切り換える
@@ -431,7 +978,6 @@ const static z80memaddr_t BIOS_EXTBIO 	= 0xFFCA;	// 拡張BIOS
 			op_RET();
 			break;
 		case MM_PUT_P3:		// 何もせずに戻る
-			m_pIoSys->Out(0xFC+3, m_R.A);
 			op_RET();
 			break;
 		case MM_GET_P3:		// ページ３の現在のセグメント番号を得る
@@ -542,1836 +1088,1882 @@ void CZ80MsxDos::MsxDosFunctionCall()
 	return;
 }
 
-bool CZ80MsxDos::patchingMapper(int *pPsegNo, int usersys)
+/** 未割当のセグメントを１つ割り当てる
+ * @param usersys 1=ユーザー、2=システム
+ */
+bool CZ80MsxDos::allocSegment(int *pSegNo, const int usersys)
+{
+	if( m_FreeSegments.empty() )
+		return false;
+	*pSegNo = m_FreeSegments.back();
+	m_FreeSegments.pop_back();
+	m_MemoryMapper[*pSegNo] = usersys;
+	return true;
+}
+
+/** 割り当て済みのセグメントを開放する
+ * @return 未割当か範囲外、DOSが使用しているセグメントなら false
+ */
+bool CZ80MsxDos::freeSegment(const int segNo)
 {
-	for( int t = 0; static_cast<int>(m_MemoryMapper.size()); ++t){
-		if( m_MemoryMapper[t] == 0 ){
-			m_MemoryMapper[t] = usersys;
-			*pPsegNo = t;
-			return true;
-		}
-	}
-	return false;
+	if( segNo < DOS_SEGMENTS || static_cast<int>(m_MemoryMapper.size()) <= segNo || m_MemoryMapper[segNo] == 0 )
+		return false;
+	m_MemoryMapper[segNo] = 0;
+	m_FreeSegments.push_back(static_cast<uint8_t>(segNo));
+	return true;
 }
 
-void CZ80MsxDos::setup()
-{
-	// TODO: 即値になっている、将来直せ。
-	// MemoryMapper[]の要素番号そのものがセグメント番号を示し、
-	// 中の値は、割り当て済みかどうかを示している。0=未割当、1=ユーザー、2=システム
-	for( int t = 0; t < 16; ++t)
-		m_MemoryMapper.push_back(0);
-	m_MemoryMapper[0] = 2;
-	m_MemoryMapper[1] = 2;
-	m_MemoryMapper[2] = 2;
-	m_MemoryMapper[3] = 2;
+/** 未割当のセグメントの数
+ */
+int CZ80MsxDos::getNumFreeSegments() const
+{
+	return static_cast<int>(m_FreeSegments.size());
+}
 
-	m_Tim.ResetBegin();
+/** addr のページにセグメント seg を割り付けて addr を呼び出す
+ * 呼び出し前のページとセグメント番号をスタックに積み、MM_RET_SEG に戻ってきたら元に戻す。
+ * CAL_SEG/CALLS を呼んだ CALL の戻り番地は、スタックに積まれたままにしておく。
+ * ページ３はスタックと戻り先を積んだページなので、PUT_P3 と同じく切り換えずに呼び出す。
+ */
+void CZ80MsxDos::callSegment(const int seg, const z80memaddr_t addr)
+{
+	const int pageNo = addr / Z80_PAGE_SIZE;
+	const uint8_t oldSeg = m_pIoSys->In(0xFC + pageNo);
+	Push16(static_cast<uint16_t>((pageNo << 8) | oldSeg));
+	Push16(MM_RET_SEG);
+	if( pageNo != 3 )
+		m_pIoSys->Out(0xFC + pageNo, static_cast<uint8_t>(seg));
+	m_R.PC = addr;
+	return;
+}
 
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_NOP));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_LD_BC_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_LD_memBC_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_INC_BC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_INC_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_DEC_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_LD_B_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_RLCA));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_EX_AF_AF));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_HL_BC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_LD_A_memBC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_DEC_BC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_INC_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_DEC_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_LD_C_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_RRCA));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_DJNZ_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_LD_DE_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_LD_memDE_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_INC_DE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_INC_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_DEC_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_LD_D_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_RLA));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_JR_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_HL_DE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_LD_A_memDE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_DEC_DE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_INC_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_DEC_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_LD_E_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_RRA));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_JR_nz_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_HL_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_INC_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_DEC_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_LD_H_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_DAA));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_JR_z_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_HL_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_HL_memAD));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_INC_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_DEC_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_LD_L_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_CPL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_JR_nc_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_LD_SP_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_LD_memAD_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_INC_SP));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memHL_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_SCF));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_JR_C_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_HL_SP));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_LD_A_memAD));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_DEC_SP));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_INC_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_DEC_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_LD_A_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_CCF));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_LD_B_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_LD_B_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_LD_B_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_LD_B_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_LD_B_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_LD_B_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_B_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_LD_B_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_LD_C_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_LD_C_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_LD_C_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_LD_C_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_LD_C_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_LD_C_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_C_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_LD_C_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_LD_D_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_LD_D_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_LD_D_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_LD_D_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_LD_D_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_LD_D_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_D_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_LD_D_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_LD_E_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_LD_E_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_LD_E_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_LD_E_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_LD_E_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_LD_E_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_E_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_LD_E_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_LD_H_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_LD_H_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_LD_H_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_LD_H_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_LD_H_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_LD_H_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_H_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_LD_H_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_LD_L_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_LD_L_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_LD_L_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_LD_L_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_LD_L_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_LD_L_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_L_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_LD_L_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memHL_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memHL_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memHL_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memHL_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memHL_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memHL_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_HALT));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memHL_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_LD_A_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_LD_A_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_LD_A_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_LD_A_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_LD_A_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_LD_A_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_A_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_LD_A_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_ADD_A_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_ADD_A_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_ADD_A_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_ADD_A_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_ADD_A_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_ADD_A_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ADD_A_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_ADD_A_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_ADC_A_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_ADC_A_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_ADC_A_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_ADC_A_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_ADC_A_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_ADC_A_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ADC_A_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_ADC_A_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_SUB_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_SUB_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_SUB_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_SUB_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_SUB_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_SUB_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_SUB_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_SUB_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_SBC_A_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_SBC_A_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_SBC_A_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_SBC_A_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_SBC_A_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_SBC_A_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_SBC_A_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_SBC_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_AND_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_AND_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_AND_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_AND_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_AND_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_AND_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_AND_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_AND_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_XOR_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_XOR_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_XOR_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_XOR_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_XOR_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_XOR_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_XOR_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_XOR_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_OR_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_OR_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_OR_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_OR_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_OR_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_OR_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_OR_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_OR_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_CP_B));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_CP_C));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_CP_D));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_CP_E));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_CP_H));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_CP_L));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_CP_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_RET_nz));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_POP_BC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_JP_nz_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_JP_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_CALL_nz_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_PUSH_BC));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_ADD_A_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_RST_0h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_RET_z));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_RET));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_JP_z_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_1));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_CALL_z_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_CALL_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_ADC_A_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_RST_8h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_RET_nc));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_POP_DE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_JP_nc_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_OUT_memv_A));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_CALL_nc_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_PUSH_DE));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SUB_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_RST_10h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_RET_c));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_EXX));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_JP_c_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_IN_A_memv));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_CALL_c_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_EXTENDED_2IX));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SBC_A_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_RST_18h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_RET_po));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_JP_po_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_CALL_po_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_AND_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_RST_20h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_RET_pe));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memHL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_JP_pe_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_EX_DE_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_CALL_pe_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_EXTENDED_3));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_XOR_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_RST_28h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_RET_p));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_POP_AF));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_JP_p_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_DI));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_CALL_p_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_PUSH_AF));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_OR_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_RST_30h));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_RET_m));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_HL));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_JP_m_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_EI));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_CALL_m_ad));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_EXTENDED_4IY));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_CP_v));
-	OpCode_Single.push_back(Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_RST_38h));
+/** 命令のディスパッチテーブル
+ * コンパイル時に作って全インスタンスで共有する。要素番号と命令コードが一致していることは static_assert で確かめる。
+ */
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Single[256] = {
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_NOP),
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_LD_BC_ad),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_LD_memBC_A),
+	Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_INC_BC),
+	Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_INC_r<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_DEC_r<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_RLCA),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_EX_AF_AF),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_HL_BC),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_LD_A_memBC),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_DEC_BC),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_INC_r<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_DEC_r<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_RRCA),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_DJNZ_v),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_LD_DE_ad),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_LD_memDE_A),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_INC_DE),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_INC_r<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_DEC_r<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_RLA),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_JR_v),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_HL_DE),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_LD_A_memDE),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_DEC_DE),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_INC_r<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_DEC_r<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_RRA),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_JR_nz_v),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_HL_ad),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_HL),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_HL),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_INC_r<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_DEC_r<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_DAA),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_JR_z_v),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_HL_HL),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_HL_memAD),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_HL),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_INC_r<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_DEC_r<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_CPL),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_JR_nc_v),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_LD_SP_ad),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_LD_memAD_A),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_INC_SP),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memHL),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memHL),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memHL_v),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_SCF),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_JR_C_v),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_HL_SP),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_LD_A_memAD),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_DEC_SP),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_INC_r<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_DEC_r<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_LD_r_v<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_CCF),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::B, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::C, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::D, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::E, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::H, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::L, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_HALT),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memHL_r<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_r_memHL<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_LD_r_r<&CZ80Regs::A, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ALU_memHL<&CZ80Regs::Add8>),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Add8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ALUCY_memHL<&CZ80Regs::Add8Cy>),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Add8Cy, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_ALU_memHL<&CZ80Regs::Sub8>),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Sub8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_ALUCY_memHL<&CZ80Regs::Sub8Cy>),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_ALUCY_r<&CZ80Regs::Sub8Cy, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_ALU_memHL<&CZ80Regs::And8>),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_ALU_r<&CZ80Regs::And8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_ALU_memHL<&CZ80Regs::Xor8>),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Xor8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_ALU_memHL<&CZ80Regs::Or8>),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_ALU_r<&CZ80Regs::Or8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_CP_r<&CZ80Regs::B>),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_CP_r<&CZ80Regs::C>),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_CP_r<&CZ80Regs::D>),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_CP_r<&CZ80Regs::E>),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_CP_r<&CZ80Regs::H>),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_CP_r<&CZ80Regs::L>),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memHL),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_CP_r<&CZ80Regs::A>),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_RET_nz),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_POP_BC),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_JP_nz_ad),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_JP_ad),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_CALL_nz_ad),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_PUSH_BC),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_ADD_A_v),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_RST_0h),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_RET_z),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_RET),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_JP_z_ad),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_1),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_CALL_z_ad),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_CALL_ad),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_ADC_A_v),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_RST_8h),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_RET_nc),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_POP_DE),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_JP_nc_ad),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_OUT_memv_A),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_CALL_nc_ad),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_PUSH_DE),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SUB_v),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_RST_10h),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_RET_c),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_EXX),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_JP_c_ad),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_IN_A_memv),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_CALL_c_ad),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_EXTENDED_2IX),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SBC_A_v),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_RST_18h),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_RET_po),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_HL),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_JP_po_ad),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_HL),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_CALL_po_ad),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_HL),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_AND_v),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_RST_20h),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_RET_pe),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memHL),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_JP_pe_ad),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_EX_DE_HL),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_CALL_pe_ad),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_EXTENDED_3),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_XOR_v),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_RST_28h),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_RET_p),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_POP_AF),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_JP_p_ad),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_DI),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_CALL_p_ad),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_PUSH_AF),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_OR_v),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_RST_30h),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_RET_m),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_HL),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_JP_m_ad),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_EI),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_CALL_m_ad),
+	Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_EXTENDED_4IY),
+	Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_CP_v),
+	Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_RST_38h),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Single), "OpCode_Single");
 
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x00, &CZ80MsxDos::op_RLC_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x01, &CZ80MsxDos::op_RLC_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x02, &CZ80MsxDos::op_RLC_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x03, &CZ80MsxDos::op_RLC_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x04, &CZ80MsxDos::op_RLC_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x05, &CZ80MsxDos::op_RLC_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x06, &CZ80MsxDos::op_RLC_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x07, &CZ80MsxDos::op_RLC_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x08, &CZ80MsxDos::op_RRC_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x09, &CZ80MsxDos::op_RRC_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0A, &CZ80MsxDos::op_RRC_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0B, &CZ80MsxDos::op_RRC_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0C, &CZ80MsxDos::op_RRC_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0D, &CZ80MsxDos::op_RRC_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0E, &CZ80MsxDos::op_RRC_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x0F, &CZ80MsxDos::op_RRC_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x10, &CZ80MsxDos::op_RL_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x11, &CZ80MsxDos::op_RL_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x12, &CZ80MsxDos::op_RL_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x13, &CZ80MsxDos::op_RL_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x14, &CZ80MsxDos::op_RL_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x15, &CZ80MsxDos::op_RL_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x16, &CZ80MsxDos::op_RL_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x17, &CZ80MsxDos::op_RL_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x18, &CZ80MsxDos::op_RR_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x19, &CZ80MsxDos::op_RR_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1A, &CZ80MsxDos::op_RR_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1B, &CZ80MsxDos::op_RR_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1C, &CZ80MsxDos::op_RR_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1D, &CZ80MsxDos::op_RR_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1E, &CZ80MsxDos::op_RR_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x1F, &CZ80MsxDos::op_RR_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x20, &CZ80MsxDos::op_SLA_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x21, &CZ80MsxDos::op_SLA_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x22, &CZ80MsxDos::op_SLA_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x23, &CZ80MsxDos::op_SLA_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x24, &CZ80MsxDos::op_SLA_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x25, &CZ80MsxDos::op_SLA_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x26, &CZ80MsxDos::op_SLA_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x27, &CZ80MsxDos::op_SLA_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x28, &CZ80MsxDos::op_SRA_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x29, &CZ80MsxDos::op_SRA_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2A, &CZ80MsxDos::op_SRA_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2B, &CZ80MsxDos::op_SRA_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2C, &CZ80MsxDos::op_SRA_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2D, &CZ80MsxDos::op_SRA_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2E, &CZ80MsxDos::op_SRA_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x2F, &CZ80MsxDos::op_SRA_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x30, &CZ80MsxDos::op_SLL_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x31, &CZ80MsxDos::op_SLL_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x32, &CZ80MsxDos::op_SLL_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x33, &CZ80MsxDos::op_SLL_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x34, &CZ80MsxDos::op_SLL_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x35, &CZ80MsxDos::op_SLL_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x36, &CZ80MsxDos::op_SLL_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x37, &CZ80MsxDos::op_SLL_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x38, &CZ80MsxDos::op_SRL_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x39, &CZ80MsxDos::op_SRL_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3A, &CZ80MsxDos::op_SRL_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3B, &CZ80MsxDos::op_SRL_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3C, &CZ80MsxDos::op_SRL_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3D, &CZ80MsxDos::op_SRL_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3E, &CZ80MsxDos::op_SRL_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x3F, &CZ80MsxDos::op_SRL_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x40, &CZ80MsxDos::op_BIT_0_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x41, &CZ80MsxDos::op_BIT_0_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x42, &CZ80MsxDos::op_BIT_0_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x43, &CZ80MsxDos::op_BIT_0_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x44, &CZ80MsxDos::op_BIT_0_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x45, &CZ80MsxDos::op_BIT_0_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x46, &CZ80MsxDos::op_BIT_0_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x47, &CZ80MsxDos::op_BIT_0_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x48, &CZ80MsxDos::op_BIT_1_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x49, &CZ80MsxDos::op_BIT_1_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4A, &CZ80MsxDos::op_BIT_1_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4B, &CZ80MsxDos::op_BIT_1_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4C, &CZ80MsxDos::op_BIT_1_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4D, &CZ80MsxDos::op_BIT_1_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4E, &CZ80MsxDos::op_BIT_1_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x4F, &CZ80MsxDos::op_BIT_1_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x50, &CZ80MsxDos::op_BIT_2_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x51, &CZ80MsxDos::op_BIT_2_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x52, &CZ80MsxDos::op_BIT_2_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x53, &CZ80MsxDos::op_BIT_2_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x54, &CZ80MsxDos::op_BIT_2_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x55, &CZ80MsxDos::op_BIT_2_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x56, &CZ80MsxDos::op_BIT_2_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x57, &CZ80MsxDos::op_BIT_2_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x58, &CZ80MsxDos::op_BIT_3_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x59, &CZ80MsxDos::op_BIT_3_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5A, &CZ80MsxDos::op_BIT_3_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5B, &CZ80MsxDos::op_BIT_3_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5C, &CZ80MsxDos::op_BIT_3_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5D, &CZ80MsxDos::op_BIT_3_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5E, &CZ80MsxDos::op_BIT_3_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x5F, &CZ80MsxDos::op_BIT_3_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x60, &CZ80MsxDos::op_BIT_4_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x61, &CZ80MsxDos::op_BIT_4_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x62, &CZ80MsxDos::op_BIT_4_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x63, &CZ80MsxDos::op_BIT_4_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x64, &CZ80MsxDos::op_BIT_4_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x65, &CZ80MsxDos::op_BIT_4_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x66, &CZ80MsxDos::op_BIT_4_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x67, &CZ80MsxDos::op_BIT_4_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x68, &CZ80MsxDos::op_BIT_5_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x69, &CZ80MsxDos::op_BIT_5_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6A, &CZ80MsxDos::op_BIT_5_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6B, &CZ80MsxDos::op_BIT_5_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6C, &CZ80MsxDos::op_BIT_5_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6D, &CZ80MsxDos::op_BIT_5_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6E, &CZ80MsxDos::op_BIT_5_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x6F, &CZ80MsxDos::op_BIT_5_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x70, &CZ80MsxDos::op_BIT_6_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x71, &CZ80MsxDos::op_BIT_6_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x72, &CZ80MsxDos::op_BIT_6_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x73, &CZ80MsxDos::op_BIT_6_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x74, &CZ80MsxDos::op_BIT_6_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x75, &CZ80MsxDos::op_BIT_6_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x76, &CZ80MsxDos::op_BIT_6_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x77, &CZ80MsxDos::op_BIT_6_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x78, &CZ80MsxDos::op_BIT_7_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x79, &CZ80MsxDos::op_BIT_7_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7A, &CZ80MsxDos::op_BIT_7_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7B, &CZ80MsxDos::op_BIT_7_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7C, &CZ80MsxDos::op_BIT_7_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7D, &CZ80MsxDos::op_BIT_7_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7E, &CZ80MsxDos::op_BIT_7_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x7F, &CZ80MsxDos::op_BIT_7_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x80, &CZ80MsxDos::op_RES_0_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x81, &CZ80MsxDos::op_RES_0_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x82, &CZ80MsxDos::op_RES_0_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x83, &CZ80MsxDos::op_RES_0_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x84, &CZ80MsxDos::op_RES_0_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x85, &CZ80MsxDos::op_RES_0_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x86, &CZ80MsxDos::op_RES_0_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x87, &CZ80MsxDos::op_RES_0_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x88, &CZ80MsxDos::op_RES_1_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x89, &CZ80MsxDos::op_RES_1_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8A, &CZ80MsxDos::op_RES_1_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8B, &CZ80MsxDos::op_RES_1_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8C, &CZ80MsxDos::op_RES_1_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8D, &CZ80MsxDos::op_RES_1_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8E, &CZ80MsxDos::op_RES_1_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x8F, &CZ80MsxDos::op_RES_1_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x90, &CZ80MsxDos::op_RES_2_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x91, &CZ80MsxDos::op_RES_2_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x92, &CZ80MsxDos::op_RES_2_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x93, &CZ80MsxDos::op_RES_2_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x94, &CZ80MsxDos::op_RES_2_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x95, &CZ80MsxDos::op_RES_2_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x96, &CZ80MsxDos::op_RES_2_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x97, &CZ80MsxDos::op_RES_2_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x98, &CZ80MsxDos::op_RES_3_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x99, &CZ80MsxDos::op_RES_3_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9A, &CZ80MsxDos::op_RES_3_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9B, &CZ80MsxDos::op_RES_3_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9C, &CZ80MsxDos::op_RES_3_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9D, &CZ80MsxDos::op_RES_3_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9E, &CZ80MsxDos::op_RES_3_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0x9F, &CZ80MsxDos::op_RES_3_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA0, &CZ80MsxDos::op_RES_4_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA1, &CZ80MsxDos::op_RES_4_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA2, &CZ80MsxDos::op_RES_4_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA3, &CZ80MsxDos::op_RES_4_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA4, &CZ80MsxDos::op_RES_4_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA5, &CZ80MsxDos::op_RES_4_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA6, &CZ80MsxDos::op_RES_4_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA7, &CZ80MsxDos::op_RES_4_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA8, &CZ80MsxDos::op_RES_5_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xA9, &CZ80MsxDos::op_RES_5_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAA, &CZ80MsxDos::op_RES_5_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAB, &CZ80MsxDos::op_RES_5_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAC, &CZ80MsxDos::op_RES_5_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAD, &CZ80MsxDos::op_RES_5_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAE, &CZ80MsxDos::op_RES_5_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xAF, &CZ80MsxDos::op_RES_5_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB0, &CZ80MsxDos::op_RES_6_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB1, &CZ80MsxDos::op_RES_6_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB2, &CZ80MsxDos::op_RES_6_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB3, &CZ80MsxDos::op_RES_6_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB4, &CZ80MsxDos::op_RES_6_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB5, &CZ80MsxDos::op_RES_6_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB6, &CZ80MsxDos::op_RES_6_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB7, &CZ80MsxDos::op_RES_6_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB8, &CZ80MsxDos::op_RES_7_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xB9, &CZ80MsxDos::op_RES_7_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBA, &CZ80MsxDos::op_RES_7_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBB, &CZ80MsxDos::op_RES_7_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBC, &CZ80MsxDos::op_RES_7_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBD, &CZ80MsxDos::op_RES_7_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBE, &CZ80MsxDos::op_RES_7_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xBF, &CZ80MsxDos::op_RES_7_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC0, &CZ80MsxDos::op_SET_0_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC1, &CZ80MsxDos::op_SET_0_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC2, &CZ80MsxDos::op_SET_0_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC3, &CZ80MsxDos::op_SET_0_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC4, &CZ80MsxDos::op_SET_0_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC5, &CZ80MsxDos::op_SET_0_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC6, &CZ80MsxDos::op_SET_0_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC7, &CZ80MsxDos::op_SET_0_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC8, &CZ80MsxDos::op_SET_1_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xC9, &CZ80MsxDos::op_SET_1_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCA, &CZ80MsxDos::op_SET_1_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCB, &CZ80MsxDos::op_SET_1_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCC, &CZ80MsxDos::op_SET_1_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCD, &CZ80MsxDos::op_SET_1_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCE, &CZ80MsxDos::op_SET_1_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xCF, &CZ80MsxDos::op_SET_1_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD0, &CZ80MsxDos::op_SET_2_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD1, &CZ80MsxDos::op_SET_2_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD2, &CZ80MsxDos::op_SET_2_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD3, &CZ80MsxDos::op_SET_2_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD4, &CZ80MsxDos::op_SET_2_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD5, &CZ80MsxDos::op_SET_2_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD6, &CZ80MsxDos::op_SET_2_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD7, &CZ80MsxDos::op_SET_2_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD8, &CZ80MsxDos::op_SET_3_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xD9, &CZ80MsxDos::op_SET_3_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDA, &CZ80MsxDos::op_SET_3_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDB, &CZ80MsxDos::op_SET_3_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDC, &CZ80MsxDos::op_SET_3_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDD, &CZ80MsxDos::op_SET_3_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDE, &CZ80MsxDos::op_SET_3_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xDF, &CZ80MsxDos::op_SET_3_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE0, &CZ80MsxDos::op_SET_4_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE1, &CZ80MsxDos::op_SET_4_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE2, &CZ80MsxDos::op_SET_4_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE3, &CZ80MsxDos::op_SET_4_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE4, &CZ80MsxDos::op_SET_4_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE5, &CZ80MsxDos::op_SET_4_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE6, &CZ80MsxDos::op_SET_4_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE7, &CZ80MsxDos::op_SET_4_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE8, &CZ80MsxDos::op_SET_5_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xE9, &CZ80MsxDos::op_SET_5_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xEA, &CZ80MsxDos::op_SET_5_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xEB, &CZ80MsxDos::op_SET_5_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xEC, &CZ80MsxDos::op_SET_5_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xED, &CZ80MsxDos::op_SET_5_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xEE, &CZ80MsxDos::op_SET_5_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xEF, &CZ80MsxDos::op_SET_5_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF0, &CZ80MsxDos::op_SET_6_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF1, &CZ80MsxDos::op_SET_6_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF2, &CZ80MsxDos::op_SET_6_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF3, &CZ80MsxDos::op_SET_6_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF4, &CZ80MsxDos::op_SET_6_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF5, &CZ80MsxDos::op_SET_6_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF6, &CZ80MsxDos::op_SET_6_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF7, &CZ80MsxDos::op_SET_6_A));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF8, &CZ80MsxDos::op_SET_7_B));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xF9, &CZ80MsxDos::op_SET_7_C));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFA, &CZ80MsxDos::op_SET_7_D));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFB, &CZ80MsxDos::op_SET_7_E));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFC, &CZ80MsxDos::op_SET_7_H));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFD, &CZ80MsxDos::op_SET_7_L));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFE, &CZ80MsxDos::op_SET_7_memHL));
-	OpCode_Extended1.push_back(Z80OPECODE_FUNC(0xFF, &CZ80MsxDos::op_SET_7_A));
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended1[256] = {
+	Z80OPECODE_FUNC(0x00, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x01, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x02, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x03, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x04, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x05, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x06, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Rlc8>),
+	Z80OPECODE_FUNC(0x07, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rlc8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x08, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x09, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x0A, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x0B, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x0C, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x0D, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x0E, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Rrc8>),
+	Z80OPECODE_FUNC(0x0F, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rrc8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x10, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x11, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x12, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x13, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x14, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x15, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x16, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Rl8>),
+	Z80OPECODE_FUNC(0x17, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rl8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x18, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x19, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x1A, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x1B, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x1C, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x1D, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x1E, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Rr8>),
+	Z80OPECODE_FUNC(0x1F, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Rr8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x20, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x21, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x22, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x23, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x24, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x25, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x26, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Sla8>),
+	Z80OPECODE_FUNC(0x27, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sla8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x28, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x29, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x2A, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x2B, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x2C, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x2D, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x2E, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Sra8>),
+	Z80OPECODE_FUNC(0x2F, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sra8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x30, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x31, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x32, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x33, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x34, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x35, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x36, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Sll8>),
+	Z80OPECODE_FUNC(0x37, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Sll8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x38, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x39, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x3A, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x3B, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x3C, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x3D, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x3E, &CZ80MsxDos::op_SHIFT_memHL<&CZ80Regs::Srl8>),
+	Z80OPECODE_FUNC(0x3F, &CZ80MsxDos::op_SHIFT_r<&CZ80Regs::Srl8, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x40, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x41, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x42, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x43, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x44, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x45, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x46, &CZ80MsxDos::op_BIT_n_memHL<0>),
+	Z80OPECODE_FUNC(0x47, &CZ80MsxDos::op_BIT_n_r<0, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x48, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x49, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x4A, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x4B, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x4C, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x4D, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x4E, &CZ80MsxDos::op_BIT_n_memHL<1>),
+	Z80OPECODE_FUNC(0x4F, &CZ80MsxDos::op_BIT_n_r<1, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x50, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x51, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x52, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x53, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x54, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x55, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x56, &CZ80MsxDos::op_BIT_n_memHL<2>),
+	Z80OPECODE_FUNC(0x57, &CZ80MsxDos::op_BIT_n_r<2, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x58, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x59, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x5A, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x5B, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x5C, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x5D, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x5E, &CZ80MsxDos::op_BIT_n_memHL<3>),
+	Z80OPECODE_FUNC(0x5F, &CZ80MsxDos::op_BIT_n_r<3, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x60, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x61, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x62, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x63, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x64, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x65, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x66, &CZ80MsxDos::op_BIT_n_memHL<4>),
+	Z80OPECODE_FUNC(0x67, &CZ80MsxDos::op_BIT_n_r<4, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x68, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x69, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x6A, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x6B, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x6C, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x6D, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x6E, &CZ80MsxDos::op_BIT_n_memHL<5>),
+	Z80OPECODE_FUNC(0x6F, &CZ80MsxDos::op_BIT_n_r<5, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x70, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x71, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x72, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x73, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x74, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x75, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x76, &CZ80MsxDos::op_BIT_n_memHL<6>),
+	Z80OPECODE_FUNC(0x77, &CZ80MsxDos::op_BIT_n_r<6, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x78, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x79, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x7A, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x7B, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x7C, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x7D, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x7E, &CZ80MsxDos::op_BIT_n_memHL<7>),
+	Z80OPECODE_FUNC(0x7F, &CZ80MsxDos::op_BIT_n_r<7, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x80, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x81, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x82, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x83, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x84, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x85, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x86, &CZ80MsxDos::op_RES_n_memHL<0>),
+	Z80OPECODE_FUNC(0x87, &CZ80MsxDos::op_RES_n_r<0, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x88, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x89, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x8A, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x8B, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x8C, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x8D, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x8E, &CZ80MsxDos::op_RES_n_memHL<1>),
+	Z80OPECODE_FUNC(0x8F, &CZ80MsxDos::op_RES_n_r<1, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x90, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x91, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x92, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x93, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x94, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x95, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x96, &CZ80MsxDos::op_RES_n_memHL<2>),
+	Z80OPECODE_FUNC(0x97, &CZ80MsxDos::op_RES_n_r<2, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0x98, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0x99, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0x9A, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0x9B, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0x9C, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0x9D, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0x9E, &CZ80MsxDos::op_RES_n_memHL<3>),
+	Z80OPECODE_FUNC(0x9F, &CZ80MsxDos::op_RES_n_r<3, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xA0, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xA1, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xA2, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xA3, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xA4, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xA5, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xA6, &CZ80MsxDos::op_RES_n_memHL<4>),
+	Z80OPECODE_FUNC(0xA7, &CZ80MsxDos::op_RES_n_r<4, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xA8, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xA9, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xAA, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xAB, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xAC, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xAD, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xAE, &CZ80MsxDos::op_RES_n_memHL<5>),
+	Z80OPECODE_FUNC(0xAF, &CZ80MsxDos::op_RES_n_r<5, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xB0, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xB1, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xB2, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xB3, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xB4, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xB5, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xB6, &CZ80MsxDos::op_RES_n_memHL<6>),
+	Z80OPECODE_FUNC(0xB7, &CZ80MsxDos::op_RES_n_r<6, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xB8, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xB9, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xBA, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xBB, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xBC, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xBD, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xBE, &CZ80MsxDos::op_RES_n_memHL<7>),
+	Z80OPECODE_FUNC(0xBF, &CZ80MsxDos::op_RES_n_r<7, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xC0, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xC1, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xC2, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xC3, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xC4, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xC5, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xC6, &CZ80MsxDos::op_SET_n_memHL<0>),
+	Z80OPECODE_FUNC(0xC7, &CZ80MsxDos::op_SET_n_r<0, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xC8, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xC9, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xCA, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xCB, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xCC, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xCD, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xCE, &CZ80MsxDos::op_SET_n_memHL<1>),
+	Z80OPECODE_FUNC(0xCF, &CZ80MsxDos::op_SET_n_r<1, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xD0, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xD1, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xD2, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xD3, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xD4, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xD5, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xD6, &CZ80MsxDos::op_SET_n_memHL<2>),
+	Z80OPECODE_FUNC(0xD7, &CZ80MsxDos::op_SET_n_r<2, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xD8, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xD9, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xDA, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xDB, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xDC, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xDD, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xDE, &CZ80MsxDos::op_SET_n_memHL<3>),
+	Z80OPECODE_FUNC(0xDF, &CZ80MsxDos::op_SET_n_r<3, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xE0, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xE1, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xE2, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xE3, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xE4, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xE5, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xE6, &CZ80MsxDos::op_SET_n_memHL<4>),
+	Z80OPECODE_FUNC(0xE7, &CZ80MsxDos::op_SET_n_r<4, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xE8, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xE9, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xEA, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xEB, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xEC, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xED, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xEE, &CZ80MsxDos::op_SET_n_memHL<5>),
+	Z80OPECODE_FUNC(0xEF, &CZ80MsxDos::op_SET_n_r<5, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xF0, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xF1, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xF2, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xF3, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xF4, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xF5, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xF6, &CZ80MsxDos::op_SET_n_memHL<6>),
+	Z80OPECODE_FUNC(0xF7, &CZ80MsxDos::op_SET_n_r<6, &CZ80Regs::A>),
+	Z80OPECODE_FUNC(0xF8, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::B>),
+	Z80OPECODE_FUNC(0xF9, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::C>),
+	Z80OPECODE_FUNC(0xFA, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::D>),
+	Z80OPECODE_FUNC(0xFB, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::E>),
+	Z80OPECODE_FUNC(0xFC, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::H>),
+	Z80OPECODE_FUNC(0xFD, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::L>),
+	Z80OPECODE_FUNC(0xFE, &CZ80MsxDos::op_SET_n_memHL<7>),
+	Z80OPECODE_FUNC(0xFF, &CZ80MsxDos::op_SET_n_r<7, &CZ80Regs::A>),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended1), "OpCode_Extended1");
 
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x03,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x04,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x05,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_IX_BC		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_IX_DE		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_IX_ad			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_IX		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_IX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_IX_IX		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_IX_memAD		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_IX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memIXpV_v		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_IX_SP		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_B_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_C_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_D_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_E_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_H_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_L_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memIXpV_B		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memIXpV_C		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memIXpV_D		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memIXpV_E		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memIXpV_H		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memIXpV_L		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memIXpV_A		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_A_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ADD_A_memIXpV	));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ADC_A_memIXpV	));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_SUB_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_SBC_A_memIXpV	));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_AND_memIXpV			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_XOR_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_OR_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memIXpV		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_2IX2	));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_IX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_IX		));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_IX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memIX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_IX			));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFD,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFE,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX.push_back(Z80OPECODE_FUNC( 0xFF,	&CZ80MsxDos::op_UNDEFINED));
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended2IX[256] = {
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x03,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x04,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x05,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_I_BC<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_I_DE<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_I_ad<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_I<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_I<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_I_I<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_I_memAD<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_I<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memIpV<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memIpV<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memIpV_v<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_I_SP<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::B, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::C, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::D, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::E, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::H, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::L, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::B, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::C, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::D, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::E, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::H, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::L, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::A, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::A, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Add8, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ALUCY_memIpV<&CZ80Regs::Add8Cy, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Sub8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_ALUCY_memIpV<&CZ80Regs::Sub8Cy, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::And8, &CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Xor8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Or8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memIpV<&CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_2IX2	),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_I<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_IX		),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_I<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memI<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_I<&CZ80Regs::IX>			),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFD,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFE,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFF,	&CZ80MsxDos::op_UNDEFINED),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended2IX), "OpCode_Extended2IX");
 
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_RLC_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_RRC_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_RL_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_RR_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_SLA_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_SRA_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_SRL_memVpIX		));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_BIT_0_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_BIT_1_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_BIT_2_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_BIT_3_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_BIT_4_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_BIT_5_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_BIT_6_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_BIT_7_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_RES_0_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_RES_1_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_RES_2_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_RES_3_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_RES_4_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_RES_5_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_RES_6_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_RES_7_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_SET_0_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_SET_1_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SET_2_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SET_3_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_SET_4_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_SET_5_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_SET_6_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_SET_7_memVpIX	));
-	OpCode_Extended2IX2.push_back(Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED));
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended2IX2[256] = {
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rlc8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rrc8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rl8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rr8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Sla8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Sra8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Srl8, &CZ80Regs::IX>		),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_BIT_n_memVpI<0, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_BIT_n_memVpI<1, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_BIT_n_memVpI<2, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_BIT_n_memVpI<3, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_BIT_n_memVpI<4, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_BIT_n_memVpI<5, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_BIT_n_memVpI<6, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_BIT_n_memVpI<7, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_RES_n_memVpI<0, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_RES_n_memVpI<1, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_RES_n_memVpI<2, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_RES_n_memVpI<3, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_RES_n_memVpI<4, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_RES_n_memVpI<5, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_RES_n_memVpI<6, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_RES_n_memVpI<7, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_SET_n_memVpI<0, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_SET_n_memVpI<1, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SET_n_memVpI<2, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SET_n_memVpI<3, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_SET_n_memVpI<4, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_SET_n_memVpI<5, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_SET_n_memVpI<6, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_SET_n_memVpI<7, &CZ80Regs::IX>	),
+	Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended2IX2), "OpCode_Extended2IX2");
 
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x03,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x04,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x05,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_IY_BC		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_IY_DE		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_IY_ad			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_IY		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_IY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_IY_IY		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_IY_memAD		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_IY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memIYpV_v		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_IY_SP		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_LD_B_IYH		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_LD_B_IYL		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_B_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_LD_C_IYH		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_LD_C_IYL		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_C_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_D_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_E_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_LD_IYH_E		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_H_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_LD_IYL_IYH		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_LD_IYL_IYL		));	// undoc.Z80
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_L_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_LD_IYL_A		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memIYpV_B	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memIYpV_C	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memIYpV_D	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memIYpV_E	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memIYpV_H	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memIYpV_L	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memIYpV_A	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_LD_A_IYH			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_LD_A_IYL			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_A_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ADD_A_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ADC_A_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_SUB_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_SBC_A_memIYpV	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_AND_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_XOR_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_OR_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memIYpV		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_4IY2	));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_IY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_IY		));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_IY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memIY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_IY			));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFD,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFE,	&CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY.push_back(Z80OPECODE_FUNC( 0xFF,	&CZ80MsxDos::op_UNDEFINED));
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended4IY[256] = {
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x03,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x04,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x05,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_ADD_I_BC<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_ADD_I_DE<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_LD_I_ad<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_LD_memAD_I<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_INC_I<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_ADD_I_I<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_LD_I_memAD<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_DEC_I<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_INC_memIpV<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_DEC_memIpV<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_LD_memIpV_v<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_ADD_I_SP<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_LD_B_IYH		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_LD_B_IYL		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::B, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_LD_C_IYH		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_LD_C_IYL		),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::C, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::D, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::E, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_LD_IYH_E		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::H, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_LD_IYL_IYH		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_LD_IYL_IYL		),	// undoc.Z80
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::L, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_LD_IYL_A		),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::B, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::C, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::D, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::E, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::H, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::L, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_LD_memIpV_r<&CZ80Regs::A, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_LD_A_IYH			),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_LD_A_IYL			),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_LD_r_memIpV<&CZ80Regs::A, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Add8, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_ALUCY_memIpV<&CZ80Regs::Add8Cy, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Sub8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_ALUCY_memIpV<&CZ80Regs::Sub8Cy, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::And8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Xor8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_ALU_memIpV<&CZ80Regs::Or8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_CP_memIpV<&CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_EXTENDED_4IY2	),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_POP_I<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_EX_memSP_IY		),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_PUSH_I<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_JP_memI<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_LD_SP_I<&CZ80Regs::IY>			),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFD,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFE,	&CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFF,	&CZ80MsxDos::op_UNDEFINED),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended4IY), "OpCode_Extended4IY");
 
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_RLC_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_RRC_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_RL_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_RR_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_SLA_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_SRA_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_SRL_memVpIY		));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_BIT_0_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_BIT_1_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_BIT_2_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_BIT_3_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_BIT_4_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_BIT_5_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_BIT_6_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_BIT_7_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_RES_0_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_RES_1_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_RES_2_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_RES_3_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_RES_4_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_RES_5_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_RES_6_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_RES_7_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_SET_0_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_SET_1_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SET_2_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SET_3_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_SET_4_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_SET_5_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_SET_6_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_SET_7_memVpIY	));
-	OpCode_Extended4IY2.push_back(Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED));
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended4IY2[256] = {
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rlc8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rrc8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rl8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Rr8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Sla8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Sra8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_SHIFT_memVpI<&CZ80Regs::Srl8, &CZ80Regs::IY>		),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_BIT_n_memVpI<0, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_BIT_n_memVpI<1, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_BIT_n_memVpI<2, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_BIT_n_memVpI<3, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_BIT_n_memVpI<4, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_BIT_n_memVpI<5, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_BIT_n_memVpI<6, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_BIT_n_memVpI<7, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_RES_n_memVpI<0, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_RES_n_memVpI<1, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_RES_n_memVpI<2, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_RES_n_memVpI<3, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_RES_n_memVpI<4, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_RES_n_memVpI<5, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_RES_n_memVpI<6, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_RES_n_memVpI<7, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_SET_n_memVpI<0, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_SET_n_memVpI<1, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_SET_n_memVpI<2, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_SET_n_memVpI<3, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_SET_n_memVpI<4, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_SET_n_memVpI<5, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_SET_n_memVpI<6, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_SET_n_memVpI<7, &CZ80Regs::IY>	),
+	Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED),
+};
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended4IY2), "OpCode_Extended4IY2");
 
+constexpr CZ80MsxDos::Z80OPECODE_FUNC CZ80MsxDos::OpCode_Extended3[256] = {
 #ifdef NDEBUG
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED ));
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_UNDEFINED ),
 #else
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_DEBUGBREAK ));
+	Z80OPECODE_FUNC( 0x00, &CZ80MsxDos::op_DEBUGBREAK ),
 #endif
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_IN_B_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_OUT_memC_B	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_SBC_HL_BC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_LD_memAD_BC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_NEG			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_RETN			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_IM_0			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_LD_i_A		));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_IN_C_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_OUT_memC_C	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_ADC_HL_BC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_LD_BC_memAD	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_RETI			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_LD_R_A		));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_IN_D_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_OUT_memC_D	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_SBC_HL_DE	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_LD_memAD_DE	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_IM_1			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_LD_A_i		));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_IN_E_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_OUT_memC_E	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_ADC_HL_DE	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_LD_DE_memAD	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_IM_2			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_LD_A_R		));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_IN_H_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_OUT_memC_H	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_SBC_HL_HL	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_RRD			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_IN_L_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_OUT_memC_L	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_ADC_HL_HL	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_RLD			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED));	// &CZ80MsxDos::op_IN_memC
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_SBC_HL_SP	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memAD_SP	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_IN_A_memC	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_OUT_memC_A	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_ADC_HL_SP	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_LD_SP_memAD	));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_LDI			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_CPI			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_INI			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_OUTI			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_LDD			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_CPD			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_IND			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_OUTD			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_LDIR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_CPIR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_INIR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_OTIR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_LDDR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_CPDR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_INDR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_OUTR			));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_UNDEFINED));
-	OpCode_Extended3.push_back(Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED));
-	return;
+	Z80OPECODE_FUNC( 0x01, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x02, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x03, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x04, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x05, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x06, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x07, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x08, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x09, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x0F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x10, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x11, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x12, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x13, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x14, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x15, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x16, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x17, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x18, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x19, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x1F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x20, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x21, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x22, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x23, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x24, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x25, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x26, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x27, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x28, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x29, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x2F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x30, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x31, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x32, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x33, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x34, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x35, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x36, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x37, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x38, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x39, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x3F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x40, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::B>	),
+	Z80OPECODE_FUNC( 0x41, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::B>	),
+	Z80OPECODE_FUNC( 0x42, &CZ80MsxDos::op_SBC_HL_BC	),
+	Z80OPECODE_FUNC( 0x43, &CZ80MsxDos::op_LD_memAD_BC	),
+	Z80OPECODE_FUNC( 0x44, &CZ80MsxDos::op_NEG			),
+	Z80OPECODE_FUNC( 0x45, &CZ80MsxDos::op_RETN			),
+	Z80OPECODE_FUNC( 0x46, &CZ80MsxDos::op_IM_0			),
+	Z80OPECODE_FUNC( 0x47, &CZ80MsxDos::op_LD_i_A		),
+	Z80OPECODE_FUNC( 0x48, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::C>	),
+	Z80OPECODE_FUNC( 0x49, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::C>	),
+	Z80OPECODE_FUNC( 0x4A, &CZ80MsxDos::op_ADC_HL_BC	),
+	Z80OPECODE_FUNC( 0x4B, &CZ80MsxDos::op_LD_BC_memAD	),
+	Z80OPECODE_FUNC( 0x4C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4D, &CZ80MsxDos::op_RETI			),
+	Z80OPECODE_FUNC( 0x4E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x4F, &CZ80MsxDos::op_LD_R_A		),
+	Z80OPECODE_FUNC( 0x50, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::D>	),
+	Z80OPECODE_FUNC( 0x51, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::D>	),
+	Z80OPECODE_FUNC( 0x52, &CZ80MsxDos::op_SBC_HL_DE	),
+	Z80OPECODE_FUNC( 0x53, &CZ80MsxDos::op_LD_memAD_DE	),
+	Z80OPECODE_FUNC( 0x54, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x55, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x56, &CZ80MsxDos::op_IM_1			),
+	Z80OPECODE_FUNC( 0x57, &CZ80MsxDos::op_LD_A_i		),
+	Z80OPECODE_FUNC( 0x58, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::E>	),
+	Z80OPECODE_FUNC( 0x59, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::E>	),
+	Z80OPECODE_FUNC( 0x5A, &CZ80MsxDos::op_ADC_HL_DE	),
+	Z80OPECODE_FUNC( 0x5B, &CZ80MsxDos::op_LD_DE_memAD	),
+	Z80OPECODE_FUNC( 0x5C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x5E, &CZ80MsxDos::op_IM_2			),
+	Z80OPECODE_FUNC( 0x5F, &CZ80MsxDos::op_LD_A_R		),
+	Z80OPECODE_FUNC( 0x60, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::H>	),
+	Z80OPECODE_FUNC( 0x61, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::H>	),
+	Z80OPECODE_FUNC( 0x62, &CZ80MsxDos::op_SBC_HL_HL	),
+	Z80OPECODE_FUNC( 0x63, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x64, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x65, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x66, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x67, &CZ80MsxDos::op_RRD			),
+	Z80OPECODE_FUNC( 0x68, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::L>	),
+	Z80OPECODE_FUNC( 0x69, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::L>	),
+	Z80OPECODE_FUNC( 0x6A, &CZ80MsxDos::op_ADC_HL_HL	),
+	Z80OPECODE_FUNC( 0x6B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x6F, &CZ80MsxDos::op_RLD			),
+	Z80OPECODE_FUNC( 0x70, &CZ80MsxDos::op_UNDEFINED),	// &CZ80MsxDos::op_IN_memC
+	Z80OPECODE_FUNC( 0x71, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x72, &CZ80MsxDos::op_SBC_HL_SP	),
+	Z80OPECODE_FUNC( 0x73, &CZ80MsxDos::op_LD_memAD_SP	),
+	Z80OPECODE_FUNC( 0x74, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x75, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x76, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x77, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x78, &CZ80MsxDos::op_IN_r_memC<&CZ80Regs::A>	),
+	Z80OPECODE_FUNC( 0x79, &CZ80MsxDos::op_OUT_memC_r<&CZ80Regs::A>	),
+	Z80OPECODE_FUNC( 0x7A, &CZ80MsxDos::op_ADC_HL_SP	),
+	Z80OPECODE_FUNC( 0x7B, &CZ80MsxDos::op_LD_SP_memAD	),
+	Z80OPECODE_FUNC( 0x7C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x7F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x80, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x81, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x82, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x83, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x84, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x85, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x86, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x87, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x88, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x89, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x8F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x90, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x91, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x92, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x93, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x94, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x95, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x96, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x97, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x98, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x99, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9A, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9B, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9C, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9D, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9E, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0x9F, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA0, &CZ80MsxDos::op_LDI			),
+	Z80OPECODE_FUNC( 0xA1, &CZ80MsxDos::op_CPI			),
+	Z80OPECODE_FUNC( 0xA2, &CZ80MsxDos::op_INI			),
+	Z80OPECODE_FUNC( 0xA3, &CZ80MsxDos::op_OUTI			),
+	Z80OPECODE_FUNC( 0xA4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xA8, &CZ80MsxDos::op_LDD			),
+	Z80OPECODE_FUNC( 0xA9, &CZ80MsxDos::op_CPD			),
+	Z80OPECODE_FUNC( 0xAA, &CZ80MsxDos::op_IND			),
+	Z80OPECODE_FUNC( 0xAB, &CZ80MsxDos::op_OUTD			),
+	Z80OPECODE_FUNC( 0xAC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xAF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB0, &CZ80MsxDos::op_LDIR			),
+	Z80OPECODE_FUNC( 0xB1, &CZ80MsxDos::op_CPIR			),
+	Z80OPECODE_FUNC( 0xB2, &CZ80MsxDos::op_INIR			),
+	Z80OPECODE_FUNC( 0xB3, &CZ80MsxDos::op_OTIR			),
+	Z80OPECODE_FUNC( 0xB4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xB8, &CZ80MsxDos::op_LDDR			),
+	Z80OPECODE_FUNC( 0xB9, &CZ80MsxDos::op_CPDR			),
+	Z80OPECODE_FUNC( 0xBA, &CZ80MsxDos::op_INDR			),
+	Z80OPECODE_FUNC( 0xBB, &CZ80MsxDos::op_OUTR			),
+	Z80OPECODE_FUNC( 0xBC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xBF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xC9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xCF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xD9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xDF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xE9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xED, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xEF, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF0, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF1, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF2, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF3, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF4, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF5, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF6, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF7, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF8, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xF9, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFA, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFB, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFC, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFD, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFE, &CZ80MsxDos::op_UNDEFINED),
+	Z80OPECODE_FUNC( 0xFF, &CZ80MsxDos::op_UNDEFINED),
 };
+static_assert(CZ80MsxDos::IsOrderedTable(CZ80MsxDos::OpCode_Extended3), "OpCode_Extended3");
+
 
 
 void CZ80MsxDos::op_UNDEFINED()
@@ -2381,160 +2973,480 @@ void CZ80MsxDos::op_UNDEFINED()
 		<< std::hex << std::setfill(_T('0')) << std::setw(4) << (int)m_R.PC << _T("h\n");
 	assert(false);
 }
-// single
-void CZ80MsxDos::op_NOP()
+// 命令群（レジスタ、ビット番号、インデックスレジスタ、演算の種類をテンプレート引数で受け取る）
+// LD r,r'
+template<CZ80MsxDos::PREG8 D, CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_LD_r_r()
 {
-	// do nothing
+	m_R.*D = m_R.*S;
 	return;
 }
-void CZ80MsxDos::op_LD_BC_ad()
+// LD r,n
+template<CZ80MsxDos::PREG8 D>
+void CZ80MsxDos::op_LD_r_v()
 {
-	m_R.C = m_pMemSys->Read(m_R.PC++);
-	m_R.B = m_pMemSys->Read(m_R.PC++);
+	// フラグ変化なし
+	m_R.*D = m_pMemSys->Read(m_R.PC++);
 	return;
 }
-void CZ80MsxDos::op_LD_memBC_A()
+// LD r,(HL)
+template<CZ80MsxDos::PREG8 D>
+void CZ80MsxDos::op_LD_r_memHL()
 {
-	m_pMemSys->Write(m_R.GetBC(), m_R.A);
+	uint16_t ad = m_R.GetHL();
+	m_R.*D = m_pMemSys->Read(ad);
 	return;
 }
-void CZ80MsxDos::op_INC_BC()
+// LD (HL),r
+template<CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_LD_memHL_r()
 {
-	// 16ビットINCはフラグを変化させない
-	m_R.SetBC( static_cast<uint16_t>(m_R.GetBC()+1) );
+	uint16_t ad = m_R.GetHL();
+	m_pMemSys->Write(ad, m_R.*S);
 	return;
 }
-void CZ80MsxDos::op_INC_B()
+// INC r
+template<CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_INC_r()
 {
-	m_R.Inc8( &m_R.B );
+	m_R.Inc8(&(m_R.*R));
 	return;
 }
-void CZ80MsxDos::op_DEC_B()
+// DEC r
+template<CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_DEC_r()
 {
-	m_R.Dec8( &m_R.B );
+	m_R.Dec8(&(m_R.*R));
 	return;
 }
-void CZ80MsxDos::op_LD_B_v()
+// ADD A,r / SUB r / AND r / XOR r / OR r
+template<CZ80MsxDos::PALU8 OP, CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_ALU_r()
 {
-	// フラグ変化なし
-	m_R.B = m_pMemSys->Read(m_R.PC++);
+	(m_R.*OP)(&m_R.A, m_R.*S);
 	return;
 }
-void CZ80MsxDos::op_RLCA()
+template<CZ80MsxDos::PALU8 OP>
+void CZ80MsxDos::op_ALU_memHL()
 {
-	const uint8_t temp = (m_R.A >> 7) & 0x01;
-	m_R.A = (m_R.A << 1) | temp;
-	//
-	m_R.F.C = temp;
-	m_R.F.Z = m_R.F.Z;
-	m_R.F.PV= m_R.F.PV;
-	m_R.F.S = m_R.F.S;
-	m_R.F.N = 0;
-	m_R.F.H = 0;
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_EX_AF_AF()
+// ADC A,r / SBC A,r
+template<CZ80MsxDos::PALU8CY OP, CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_ALUCY_r()
 {
-	// フラグの状態は変化しない
-	m_R.Swap(&m_R.A, &m_R.Ad);
-	m_R.Swap(&m_R.F, &m_R.Fd);
+	(m_R.*OP)(&m_R.A, m_R.*S, m_R.F.C);
 	return;
 }
-void CZ80MsxDos::op_ADD_HL_BC()
+template<CZ80MsxDos::PALU8CY OP>
+void CZ80MsxDos::op_ALUCY_memHL()
 {
-	uint16_t hl = m_R.GetHL();
-	m_R.Add16(&hl, m_R.GetBC());
-	m_R.SetHL(hl);
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&m_R.A, v, m_R.F.C);
 	return;
 }
-void CZ80MsxDos::op_LD_A_memBC()
+// CP r
+template<CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_CP_r()
 {
-	// フラグ変化なし
-	m_R.A = m_pMemSys->Read(m_R.GetBC());
+	uint8_t temp = m_R.A;
+	m_R.Sub8(&temp, m_R.*S);
 	return;
 }
-
-void CZ80MsxDos::op_DEC_BC()
+// RLC/RRC/RL/RR/SLA/SRA/SLL/SRL r
+template<CZ80MsxDos::PSHIFT8 OP, CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_SHIFT_r()
 {
-	// 16ビットDECはフラグを変化させない
-	m_R.SetBC( static_cast<uint16_t>(m_R.GetBC()-1) );
+	(m_R.*OP)(&(m_R.*R));
 	return;
 }
-void CZ80MsxDos::op_INC_C()
+template<CZ80MsxDos::PSHIFT8 OP>
+void CZ80MsxDos::op_SHIFT_memHL()
 {
-	m_R.Inc8(&m_R.C);
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&v);
+	m_pMemSys->Write(m_R.GetHL(), v);
 	return;
 }
-void CZ80MsxDos::op_DEC_C()
+// BIT n,r
+template<int N, CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_BIT_n_r()
 {
-	m_R.Dec8(&m_R.C);
+	m_R.F.Z = (((m_R.*R)>>N) & 0x01) ^ 0x01;
+	m_R.F.N = 0, m_R.F.H = 1;
 	return;
 }
-void CZ80MsxDos::op_LD_C_v()
+template<int N>
+void CZ80MsxDos::op_BIT_n_memHL()
 {
-	// フラグ変化なし
-	m_R.C = m_pMemSys->Read(m_R.PC++);
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	m_R.F.Z = ((v>>N) & 0x01) ^ 0x01;
+	m_R.F.N = 0, m_R.F.H = 1;
 	return;
 }
-void CZ80MsxDos::op_RRCA()
+// RES n,r
+template<int N, CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_RES_n_r()
 {
-	const uint8_t temp = m_R.A & 0x01;
-	m_R.A = (m_R.A >> 1) | (temp << 7);
-	//
-	m_R.F.C = temp;
-	m_R.F.Z = m_R.F.Z;
-	m_R.F.PV= m_R.F.PV;
-	m_R.F.S = m_R.F.S;
-	m_R.F.N = 0;
-	m_R.F.H = 0;
+	m_R.*R &= ((0x01 << N) ^ 0xFF);
 	return;
 }
-void CZ80MsxDos::op_DJNZ_v()
+template<int N>
+void CZ80MsxDos::op_RES_n_memHL()
 {
-	m_R.B--;
-	if( m_R.B == 0 ){
-		m_R.PC++;	// v を読み捨て
-	}
-	else{
-		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
-		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
-	}
-	return;
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	v &= ((0x01 << N) ^ 0xFF);
+	m_pMemSys->Write(m_R.GetHL(), v);
+	return;
 }
-void CZ80MsxDos::op_LD_DE_ad()
+// SET n,r
+template<int N, CZ80MsxDos::PREG8 R>
+void CZ80MsxDos::op_SET_n_r()
 {
-	m_R.E = m_pMemSys->Read(m_R.PC++);
-	m_R.D = m_pMemSys->Read(m_R.PC++);
+	m_R.*R |= 0x01 << N;
 	return;
 }
-void CZ80MsxDos::op_LD_memDE_A()
+template<int N>
+void CZ80MsxDos::op_SET_n_memHL()
 {
-	uint16_t ad = m_R.GetDE();
-	m_pMemSys->Write(ad, m_R.A);
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	v |= 0x01 << N;
+	m_pMemSys->Write(m_R.GetHL(), v);
 	return;
 }
-void CZ80MsxDos::op_INC_DE()
+// IN r,(C)
+template<CZ80MsxDos::PREG8 D>
+void CZ80MsxDos::op_IN_r_memC()
+{
+	// ※Bレジスタによる16bitアドレスは考慮しない。
+	m_R.*D = m_pIoSys->In(m_R.C);
+	m_R.SetFlagByIN(m_R.*D);
+	return;
+}
+// OUT (C),r
+template<CZ80MsxDos::PREG8 S>
+void CZ80MsxDos::op_OUT_memC_r()
+{
+	m_pIoSys->Out(m_R.C, m_R.*S);
+	return;
+}
+// 以下は DDh(IX)/FDh(IY) で共通
+// LD I,nn
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_I_ad()
+{
+	m_R.*I = m_pMemSys->Read(m_R.PC++);
+	m_R.*I |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	return;
+}
+// LD (nn),I
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_memAD_I()
+{
+	uint16_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	//
+	m_pMemSys->Write(ad+0, ((m_R.*I)>>0)&0xff);
+	m_pMemSys->Write(ad+1, ((m_R.*I)>>8)&0xff);
+	return;
+}
+// LD I,(nn)
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_I_memAD()
+{
+	uint16_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	//
+	m_R.*I = m_pMemSys->Read(ad + 0);
+	m_R.*I |= static_cast<uint16_t>(m_pMemSys->Read(ad + 1)) << 8;
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_INC_I()
+{
+	++(m_R.*I);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_DEC_I()
+{
+	--(m_R.*I);
+	return;
+}
+// ADD I,BC / ADD I,DE / ADD I,I / ADD I,SP
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ADD_I_BC()
+{
+	m_R.Add16(&(m_R.*I), m_R.GetBC());
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ADD_I_DE()
+{
+	m_R.Add16(&(m_R.*I), m_R.GetDE());
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ADD_I_I()
+{
+	m_R.Add16(&(m_R.*I), m_R.*I);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ADD_I_SP()
+{
+	m_R.Add16(&(m_R.*I), m_R.SP);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_POP_I()
+{
+	m_R.*I = m_pMemSys->Read(m_R.SP++);
+	m_R.*I |= static_cast<uint16_t>(m_pMemSys->Read(m_R.SP++)) << 8;
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_PUSH_I()
+{
+	m_pMemSys->Write(--m_R.SP, ((m_R.*I)>>8)&0xFF);
+	m_pMemSys->Write(--m_R.SP, ((m_R.*I)>>0)&0xFF);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_JP_memI()
+{
+	m_R.PC = m_R.*I;	// IX/IYの値そのものがアドレス値である
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_SP_I()
+{
+	m_R.SP = m_R.*I;
+	return;
+}
+// LD r,(I+d)
+template<CZ80MsxDos::PREG8 D, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_r_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	m_R.*D = m_pMemSys->Read(ad);
+	return;
+}
+// LD (I+d),r
+template<CZ80MsxDos::PREG8 S, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_memIpV_r()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	m_pMemSys->Write(ad, m_R.*S);
+	return;
+}
+// LD (I+d),n
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_LD_memIpV_v()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_pMemSys->Write(ad, v);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_INC_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	m_R.Inc8(&v);
+	m_pMemSys->Write(ad, v);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_DEC_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	m_R.Dec8(&v);
+	m_pMemSys->Write(ad, v);
+	return;
+}
+// ADD A,(I+d) / SUB (I+d) / AND (I+d) / XOR (I+d) / OR (I+d)
+template<CZ80MsxDos::PALU8 OP, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ALU_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&m_R.A, v);
+	return;
+}
+// ADC A,(I+d) / SBC A,(I+d)
+template<CZ80MsxDos::PALU8CY OP, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_ALUCY_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&m_R.A, v, m_R.F.C);
+	return;
+}
+template<CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_CP_memIpV()
+{
+	uint16_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	uint8_t tempA = m_R.A;
+	m_R.Sub8(&tempA, v);
+	return;
+}
+// DDh+CBh / FDh+CBh（d は命令コードの前にある）
+// RLC/RRC/RL/RR/SLA/SRA/SRL (I+d)
+template<CZ80MsxDos::PSHIFT8 OP, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_SHIFT_memVpI()
+{
+	z80memaddr_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	(m_R.*OP)(&v);
+	m_pMemSys->Write(ad, v);
+	return;
+}
+template<int N, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_BIT_n_memVpI()
+{
+	z80memaddr_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	m_R.F.Z = ((v>>N) & 0x01) ^ 0x01;
+	m_R.F.N = 0, m_R.F.H = 1;
+	return;
+}
+template<int N, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_RES_n_memVpI()
+{
+	z80memaddr_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	v &= ((0x01 << N) ^ 0xFF);
+	m_pMemSys->Write(ad, v);
+	return;
+}
+template<int N, CZ80MsxDos::PREG16 I>
+void CZ80MsxDos::op_SET_n_memVpI()
+{
+	z80memaddr_t ad = m_R.*I + m_pMemSys->Read(m_R.PC++);
+	uint8_t v = m_pMemSys->Read(ad);
+	v |= 0x01 << N;
+	m_pMemSys->Write(ad, v);
+	return;
+}
+// single
+void CZ80MsxDos::op_NOP()
+{
+	// do nothing
+	return;
+}
+void CZ80MsxDos::op_LD_BC_ad()
+{
+	m_R.C = m_pMemSys->Read(m_R.PC++);
+	m_R.B = m_pMemSys->Read(m_R.PC++);
+	return;
+}
+void CZ80MsxDos::op_LD_memBC_A()
+{
+	m_pMemSys->Write(m_R.GetBC(), m_R.A);
+	return;
+}
+void CZ80MsxDos::op_INC_BC()
 {
 	// 16ビットINCはフラグを変化させない
-	m_R.SetDE(static_cast<uint16_t>(m_R.GetDE() + 1));
+	m_R.SetBC( static_cast<uint16_t>(m_R.GetBC()+1) );
+	return;
+}
+void CZ80MsxDos::op_RLCA()
+{
+	const uint8_t temp = (m_R.A >> 7) & 0x01;
+	m_R.A = (m_R.A << 1) | temp;
+	//
+	m_R.F.C = temp;
+	m_R.F.Z = m_R.F.Z;
+	m_R.F.PV= m_R.F.PV;
+	m_R.F.S = m_R.F.S;
+	m_R.F.N = 0;
+	m_R.F.H = 0;
 	return;
 }
-void CZ80MsxDos::op_INC_D()
+void CZ80MsxDos::op_EX_AF_AF()
 {
-	m_R.Inc8(&m_R.D);
+	// フラグの状態は変化しない
+	m_R.Swap(&m_R.A, &m_R.Ad);
+	m_R.Swap(&m_R.F, &m_R.Fd);
 	return;
 }
-void CZ80MsxDos::op_DEC_D()
+void CZ80MsxDos::op_ADD_HL_BC()
 {
-	m_R.Dec8(&m_R.D);
+	uint16_t hl = m_R.GetHL();
+	m_R.Add16(&hl, m_R.GetBC());
+	m_R.SetHL(hl);
 	return;
 }
-void CZ80MsxDos::op_LD_D_v()
+void CZ80MsxDos::op_LD_A_memBC()
 {
 	// フラグ変化なし
+	m_R.A = m_pMemSys->Read(m_R.GetBC());
+	return;
+}
+
+void CZ80MsxDos::op_DEC_BC()
+{
+	// 16ビットDECはフラグを変化させない
+	m_R.SetBC( static_cast<uint16_t>(m_R.GetBC()-1) );
+	return;
+}
+void CZ80MsxDos::op_RRCA()
+{
+	const uint8_t temp = m_R.A & 0x01;
+	m_R.A = (m_R.A >> 1) | (temp << 7);
+	//
+	m_R.F.C = temp;
+	m_R.F.Z = m_R.F.Z;
+	m_R.F.PV= m_R.F.PV;
+	m_R.F.S = m_R.F.S;
+	m_R.F.N = 0;
+	m_R.F.H = 0;
+	return;
+}
+void CZ80MsxDos::op_DJNZ_v()
+{
+	m_R.B--;
+	if( m_R.B == 0 ){
+		m_R.PC++;	// v を読み捨て
+	}
+	else{
+		m_Clock.AddTStates(Z80TS_JR_TAKEN);
+		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
+		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
+	}
+	return;
+}
+void CZ80MsxDos::op_LD_DE_ad()
+{
+	m_R.E = m_pMemSys->Read(m_R.PC++);
 	m_R.D = m_pMemSys->Read(m_R.PC++);
 	return;
 }
+void CZ80MsxDos::op_LD_memDE_A()
+{
+	uint16_t ad = m_R.GetDE();
+	m_pMemSys->Write(ad, m_R.A);
+	return;
+}
+void CZ80MsxDos::op_INC_DE()
+{
+	// 16ビットINCはフラグを変化させない
+	m_R.SetDE(static_cast<uint16_t>(m_R.GetDE() + 1));
+	return;
+}
 void CZ80MsxDos::op_RLA()
 {
 	const uint8_t temp = (m_R.A >> 7) & 0x01;
@@ -2573,22 +3485,6 @@ void CZ80MsxDos::op_DEC_DE()
 	m_R.SetDE( static_cast<uint16_t>(m_R.GetDE()-1) );
 	return;
 }
-void CZ80MsxDos::op_INC_E()
-{
-	m_R.Inc8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_DEC_E()
-{
-	m_R.Dec8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_LD_E_v()
-{
-	// フラグ変化なし
-	m_R.E = m_pMemSys->Read(m_R.PC++);
-	return;
-}
 void CZ80MsxDos::op_RRA()
 {
 	const uint8_t temp = m_R.A & 0x01;
@@ -2605,6 +3501,7 @@ void CZ80MsxDos::op_RRA()
 void CZ80MsxDos::op_JR_nz_v()
 {
 	if( m_R.F.Z == 0 ){
+		m_Clock.AddTStates(Z80TS_JR_TAKEN);
 		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
 		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
 	}
@@ -2634,22 +3531,6 @@ void CZ80MsxDos::op_INC_HL()
 	m_R.SetHL( static_cast<uint16_t>(m_R.GetHL()+1) );
 	return;
 }
-void CZ80MsxDos::op_INC_H()
-{
-	m_R.Inc8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_DEC_H()
-{
-	m_R.Dec8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_LD_H_v()
-{
-	// フラグ変化なし
-	m_R.H = m_pMemSys->Read(m_R.PC++);
-	return;
-}
 void CZ80MsxDos::op_DAA()
 {
 	const uint8_t Lo = (m_R.A >> 0) & 0x0f;
@@ -2686,6 +3567,7 @@ void CZ80MsxDos::op_DAA()
 void CZ80MsxDos::op_JR_z_v()
 {
 	if( m_R.F.Z != 0 ){
+		m_Clock.AddTStates(Z80TS_JR_TAKEN);
 		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
 		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
 	}
@@ -2716,22 +3598,6 @@ void CZ80MsxDos::op_DEC_HL()
 	m_R.SetHL( static_cast<uint16_t>(m_R.GetHL()-1) );
 	return;
 }
-void CZ80MsxDos::op_INC_L()
-{
-	m_R.Inc8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_DEC_L()
-{
-	m_R.Dec8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_LD_L_v()
-{
-	// フラグ変化なし
-	m_R.L = m_pMemSys->Read(m_R.PC++);
-	return;
-}
 void CZ80MsxDos::op_CPL()
 {
 	m_R.A = m_R.A ^ 0xff;
@@ -2747,6 +3613,7 @@ void CZ80MsxDos::op_CPL()
 void CZ80MsxDos::op_JR_nc_v()
 {
 	if( m_R.F.C == 0 ){
+		m_Clock.AddTStates(Z80TS_JR_TAKEN);
 		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
 		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
 	}
@@ -2805,6 +3672,7 @@ void CZ80MsxDos::op_SCF()
 void CZ80MsxDos::op_JR_C_v()
 {
 	if( m_R.F.C != 0 ){
+		m_Clock.AddTStates(Z80TS_JR_TAKEN);
 		int8_t off = m_pMemSys->ReadInt8(m_R.PC);
 		m_R.PC = static_cast<uint16_t>(static_cast<int32_t>(m_R.PC-1) + 2 + off);
 	}
@@ -2834,3404 +3702,770 @@ void CZ80MsxDos::op_DEC_SP()
 	--m_R.SP;
 	return;
 }
-void CZ80MsxDos::op_INC_A()
+
+void CZ80MsxDos::op_CCF()
 {
-	m_R.Inc8(&m_R.A);
+	m_R.F.C = (m_R.F.C==0)?1:0;
 	return;
 }
-void CZ80MsxDos::op_DEC_A()
+void CZ80MsxDos::op_HALT()
 {
-	m_R.Dec8(&m_R.A);
+	m_bHalt = true;
 	return;
 }
 
-void CZ80MsxDos::op_LD_A_v()
+void CZ80MsxDos::op_CP_memHL()
 {
-	m_R.A = m_pMemSys->Read(m_R.PC++);
-	return;
-}
-void CZ80MsxDos::op_CCF()
-{
-	m_R.F.C = (m_R.F.C==0)?1:0;
-	return;
-}
-void CZ80MsxDos::op_LD_B_B()
-{
-	m_R.B = m_R.B;
-	return;
-}
-void CZ80MsxDos::op_LD_B_C()
-{
-	m_R.B = m_R.C;
+	uint16_t ad = m_R.GetHL();
+	uint8_t v = m_pMemSys->Read(ad);
+	uint8_t temp = m_R.A;
+	m_R.Sub8(&temp, v);
 	return;
 }
-void CZ80MsxDos::op_LD_B_D()
+void CZ80MsxDos::op_RET_nz()
 {
-	m_R.B = m_R.D;
+	if( m_R.F.Z == 0 ){
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_B_E()
+void CZ80MsxDos::op_POP_BC()
 {
-	m_R.B = m_R.E;
+	m_R.C = m_pMemSys->Read(m_R.SP++);
+	m_R.B = m_pMemSys->Read(m_R.SP++);
 	return;
 }
-void CZ80MsxDos::op_LD_B_H()
+void CZ80MsxDos::op_JP_nz_ad()
 {
-	m_R.B = m_R.H;
+	if( m_R.F.Z == 0 ){
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_B_L()
+void CZ80MsxDos::op_JP_ad()
 {
-	m_R.B = m_R.L;
+	uint16_t temp = m_pMemSys->Read(m_R.PC++);
+	temp |= m_pMemSys->Read(m_R.PC) << 8;
+	m_R.PC = temp;
 	return;
 }
-void CZ80MsxDos::op_LD_B_memHL()
+void CZ80MsxDos::op_CALL_nz_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.B = m_pMemSys->Read(ad);
+	if( m_R.F.Z == 0 ){
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_B_A()
+void CZ80MsxDos::op_PUSH_BC()
 {
-	m_R.B = m_R.A;
+	m_pMemSys->Write(--m_R.SP, m_R.B);
+	m_pMemSys->Write(--m_R.SP, m_R.C);
 	return;
 }
-void CZ80MsxDos::op_LD_C_B()
+void CZ80MsxDos::op_ADD_A_v()
 {
-	m_R.C = m_R.B;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Add8(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_LD_C_C()
+void CZ80MsxDos::op_RST_0h()
 {
-	m_R.C = m_R.C;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x00;
 	return;
 }
-void CZ80MsxDos::op_LD_C_D()
+void CZ80MsxDos::op_RET_z()
 {
-	m_R.C = m_R.D;
+	if( m_R.F.Z != 0 ){
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_C_E()
+void CZ80MsxDos::op_RET()
 {
-	m_R.C = m_R.E;
+	m_R.PC = m_pMemSys->Read(m_R.SP++);
+	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
 	return;
 }
-void CZ80MsxDos::op_LD_C_H()
+void CZ80MsxDos::op_JP_z_ad()
 {
-	m_R.C = m_R.H;
+	if( m_R.F.Z != 0 ){
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_C_L()
+void CZ80MsxDos::op_EXTENDED_1()
 {
-	m_R.C = m_R.L;
+	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
+	m_Clock.AddTStates(Z80TS_CB[opcd]);
+	auto pFunc = OpCode_Extended1[opcd].pFunc;
+	(this->*pFunc)();
 	return;
 }
-void CZ80MsxDos::op_LD_C_memHL()
+void CZ80MsxDos::op_CALL_z_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.C = m_pMemSys->Read(ad);
+	if( m_R.F.Z != 0 ){
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_C_A()
+void CZ80MsxDos::op_CALL_ad()
 {
-	m_R.C = m_R.A;
+	uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+	destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = destAddr;
 	return;
 }
-void CZ80MsxDos::op_LD_D_B()
+void CZ80MsxDos::op_ADC_A_v()
 {
-	m_R.D = m_R.B;
+	uint8_t v= m_pMemSys->Read(m_R.PC++);
+	m_R.Add8Cy(&m_R.A, v, m_R.F.C);
 	return;
 }
-void CZ80MsxDos::op_LD_D_C()
+void CZ80MsxDos::op_RST_8h()
 {
-	m_R.D = m_R.C;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x08;
 	return;
 }
-void CZ80MsxDos::op_LD_D_D()
+void CZ80MsxDos::op_RET_nc()
 {
-	m_R.D = m_R.D;
+	if( m_R.F.C == 0 ){
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_D_E()
+void CZ80MsxDos::op_POP_DE()
 {
-	m_R.D = m_R.E;
+	m_R.E = m_pMemSys->Read(m_R.SP++);
+	m_R.D = m_pMemSys->Read(m_R.SP++);
 	return;
 }
-void CZ80MsxDos::op_LD_D_H()
+void CZ80MsxDos::op_JP_nc_ad()
 {
-	m_R.D = m_R.H;
+	if( m_R.F.C == 0 ){
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_D_L()
+void CZ80MsxDos::op_OUT_memv_A()
 {
-	m_R.D = m_R.L;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_pIoSys->Out(v, m_R.A);
 	return;
 }
-void CZ80MsxDos::op_LD_D_memHL()
+void CZ80MsxDos::op_CALL_nc_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.D = m_pMemSys->Read(ad);
+	if( m_R.F.C == 0 ){
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_D_A()
+void CZ80MsxDos::op_PUSH_DE()
 {
-	m_R.D = m_R.A;
+	m_pMemSys->Write(--m_R.SP, m_R.D);
+	m_pMemSys->Write(--m_R.SP, m_R.E);
 	return;
 }
-void CZ80MsxDos::op_LD_E_B()
+void CZ80MsxDos::op_SUB_v()
 {
-	m_R.E = m_R.B;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Sub8(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_LD_E_C()
+void CZ80MsxDos::op_RST_10h()
 {
-	m_R.E = m_R.C;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x10;
 	return;
 }
-void CZ80MsxDos::op_LD_E_D()
+void CZ80MsxDos::op_RET_c()
 {
-	m_R.E = m_R.D;
+	if( m_R.F.C != 0 ){
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_E_E()
+void CZ80MsxDos::op_EXX()
 {
-	m_R.E = m_R.E;
+	m_R.Exchange();
 	return;
 }
-void CZ80MsxDos::op_LD_E_H()
+void CZ80MsxDos::op_JP_c_ad()
 {
-	m_R.E = m_R.H;
+	if( m_R.F.C != 0 ){
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_E_L()
+void CZ80MsxDos::op_IN_A_memv()
 {
-	m_R.E = m_R.L;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.A = m_pIoSys->In(v);
 	return;
 }
-void CZ80MsxDos::op_LD_E_memHL()
+void CZ80MsxDos::op_CALL_c_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.E = m_pMemSys->Read(ad);
+	if( m_R.F.C != 0 ){
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_E_A()
+void CZ80MsxDos::op_EXTENDED_2IX()
 {
-	m_R.E = m_R.A;
+	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
+	m_Clock.AddTStates(Z80TS_DD[opcd]);
+	auto pFunc = OpCode_Extended2IX[opcd].pFunc;
+	(this->*pFunc)();
 	return;
 }
-void CZ80MsxDos::op_LD_H_B()
+void CZ80MsxDos::op_SBC_A_v()
 {
-	m_R.H = m_R.B;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Sub8Cy(&m_R.A, v, m_R.F.C);
 	return;
 }
-void CZ80MsxDos::op_LD_H_C()
+void CZ80MsxDos::op_RST_18h()
 {
-	m_R.H = m_R.C;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x18;
 	return;
 }
-void CZ80MsxDos::op_LD_H_D()
+void CZ80MsxDos::op_RET_po()
 {
-	m_R.H = m_R.D;
+	if( m_R.F.PV == 0 ){	// PO
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_H_E()
+void CZ80MsxDos::op_POP_HL()
 {
-	m_R.H = m_R.E;
+	m_R.L = m_pMemSys->Read(m_R.SP++);
+	m_R.H = m_pMemSys->Read(m_R.SP++);
 	return;
 }
-void CZ80MsxDos::op_LD_H_H()
+void CZ80MsxDos::op_JP_po_ad()
 {
-	m_R.H = m_R.H;
+	if( m_R.F.PV == 0 ){
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_H_L()
+void CZ80MsxDos::op_EX_memSP_HL()
 {
-	m_R.H = m_R.L;
+	uint8_t rl = m_R.L, rh = m_R.H;
+	m_R.L = m_pMemSys->Read(m_R.SP+0);
+	m_R.H = m_pMemSys->Read(m_R.SP+1);
+	m_pMemSys->Write(m_R.SP+0, rl);
+	m_pMemSys->Write(m_R.SP+1, rh);
 	return;
 }
-void CZ80MsxDos::op_LD_H_memHL()
+void CZ80MsxDos::op_CALL_po_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.H = m_pMemSys->Read(ad);
+	if( m_R.F.PV == 0 ){
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_H_A()
+void CZ80MsxDos::op_PUSH_HL()
 {
-	m_R.H = m_R.A;
+	m_pMemSys->Write(--m_R.SP, m_R.H);
+	m_pMemSys->Write(--m_R.SP, m_R.L);
 	return;
 }
-void CZ80MsxDos::op_LD_L_B()
+void CZ80MsxDos::op_AND_v()
 {
-	m_R.L = m_R.B;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.And8(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_LD_L_C()
+void CZ80MsxDos::op_RST_20h()
 {
-	m_R.L = m_R.C;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x20;
 	return;
 }
-void CZ80MsxDos::op_LD_L_D()
+void CZ80MsxDos::op_RET_pe()
 {
-	m_R.L = m_R.D;
+	if( m_R.F.PV != 0 ){	// PE
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_L_E()
+void CZ80MsxDos::op_JP_memHL()
 {
-	m_R.L = m_R.E;
+	m_R.PC = m_R.GetHL();	// HLの値そのものがアドレス値である。
 	return;
 }
-void CZ80MsxDos::op_LD_L_H()
+
+void CZ80MsxDos::op_JP_pe_ad()
 {
-	m_R.L = m_R.H;
+	if( m_R.F.PV != 0 ){ // PE
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_L_L()
+void CZ80MsxDos::op_EX_DE_HL()
 {
-	m_R.L = m_R.L;
+	uint16_t temp = m_R.GetDE();
+	m_R.SetDE(m_R.GetHL());
+	m_R.SetHL(temp);
 	return;
 }
-void CZ80MsxDos::op_LD_L_memHL()
+void CZ80MsxDos::op_CALL_pe_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.L = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_L_A()
-{
-	m_R.L = m_R.A;
-	return;
-}
-void CZ80MsxDos::op_LD_memHL_B()
-{
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.B);
+	if( m_R.F.PV != 0 ){ // PE
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_C()
+void CZ80MsxDos::op_EXTENDED_3()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.C);
+	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
+	m_Clock.AddTStates(Z80TS_ED[opcd]);
+	auto pFunc = OpCode_Extended3[opcd].pFunc;
+	(this->*pFunc)();
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_D()
+void CZ80MsxDos::op_XOR_v()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.D);
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Xor8(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_E()
+void CZ80MsxDos::op_RST_28h()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.E);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x28;
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_H()
+void CZ80MsxDos::op_RET_p()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.H);
+	if( m_R.F.S == 0 ){	// P
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_L()
+void CZ80MsxDos::op_POP_AF()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.L);
+	m_R.F.Set(m_pMemSys->Read(m_R.SP++));
+	m_R.A = m_pMemSys->Read(m_R.SP++);
 	return;
 }
-void CZ80MsxDos::op_HALT()
+void CZ80MsxDos::op_JP_p_ad()
 {
-	m_bHalt = true;
+	if( m_R.F.S == 0 ){ // P
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_memHL_A()
+void CZ80MsxDos::op_DI()
 {
-	uint16_t ad = m_R.GetHL();
-	m_pMemSys->Write(ad, m_R.A);
+	m_bIFF1 = m_bIFF2 = false;
 	return;
 }
-void CZ80MsxDos::op_LD_A_B()
+void CZ80MsxDos::op_CALL_p_ad()
 {
-	m_R.A = m_R.B;
+	if( m_R.F.S == 0 ){ // P
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_A_C()
+void CZ80MsxDos::op_PUSH_AF()
 {
-	m_R.A = m_R.C;
+	m_pMemSys->Write(--m_R.SP, m_R.A);
+	m_pMemSys->Write(--m_R.SP, m_R.F.Get());
 	return;
 }
-void CZ80MsxDos::op_LD_A_D()
+void CZ80MsxDos::op_OR_v()
 {
-	m_R.A = m_R.D;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Or8(&m_R.A, v);
 	return;
 }
-void CZ80MsxDos::op_LD_A_E()
+void CZ80MsxDos::op_RST_30h()
 {
-	m_R.A = m_R.E;
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x30;
 	return;
 }
-void CZ80MsxDos::op_LD_A_H()
+void CZ80MsxDos::op_RET_m()
 {
-	m_R.A = m_R.H;
+	if( m_R.F.S != 0 ){	// M
+		m_Clock.AddTStates(Z80TS_RET_TAKEN);
+		m_R.PC = m_pMemSys->Read(m_R.SP++);
+		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_A_L()
+void CZ80MsxDos::op_LD_SP_HL()
 {
-	m_R.A = m_R.L;
+	m_R.SP = m_R.GetHL();
 	return;
 }
-void CZ80MsxDos::op_LD_A_memHL()
+void CZ80MsxDos::op_JP_m_ad()
 {
-	uint16_t ad = m_R.GetHL();
-	m_R.A = m_pMemSys->Read(ad);
+	if( m_R.F.S != 0 ){ // M
+		uint16_t temp = m_pMemSys->Read(m_R.PC++);
+		temp |= m_pMemSys->Read(m_R.PC) << 8;
+		m_R.PC = temp;
+	}
+	else{
+		m_R.PC += 2;	// nnを読み捨て
+	}
 	return;
 }
-void CZ80MsxDos::op_LD_A_A()
+void CZ80MsxDos::op_EI()
 {
-	m_R.A = m_R.A;
+	m_bIFF1 = m_bIFF2 = true;
+	m_bEiDelay = true;
 	return;
 }
-
-void CZ80MsxDos::op_ADD_A_B()
+void CZ80MsxDos::op_CALL_m_ad()
 {
-	m_R.Add8(&m_R.A, m_R.B);
+	if( m_R.F.S != 0 ){ // M
+		m_Clock.AddTStates(Z80TS_CALL_TAKEN);
+		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
+		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+		m_R.PC = destAddr;
+	}
+	else{
+		m_R.PC += 2;
+	}
 	return;
 }
-void CZ80MsxDos::op_ADD_A_C()
+void CZ80MsxDos::op_EXTENDED_4IY()
 {
-	m_R.Add8(&m_R.A, m_R.C);
+	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
+	m_Clock.AddTStates(Z80TS_DD[opcd]);
+	auto pFunc = OpCode_Extended4IY[opcd].pFunc;
+	(this->*pFunc)();
 	return;
 }
-void CZ80MsxDos::op_ADD_A_D()
+void CZ80MsxDos::op_CP_v()
 {
-	m_R.Add8(&m_R.A, m_R.D);
+	uint8_t tempA = m_R.A;
+	uint8_t v = m_pMemSys->Read(m_R.PC++);
+	m_R.Sub8(&tempA, v);
 	return;
 }
-void CZ80MsxDos::op_ADD_A_E()
+void CZ80MsxDos::op_RST_38h()
 {
-	m_R.Add8(&m_R.A, m_R.E);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
+	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
+	m_R.PC = 0x38;
 	return;
 }
-void CZ80MsxDos::op_ADD_A_H()
+
+// extended1
+
+
+// extended2 for IX
+void CZ80MsxDos::op_EXTENDED_2IX2()
 {
-	m_R.Add8(&m_R.A, m_R.H);
+	// このマシンコードは、DDh+CBh+nn+vv の形式になっていて、
+	// データ部nnがコードの途中に位置していることに注意する
+	// このメソッドが呼ばれた時点で、DDh+CBhまではデコードされているからPCの位置はnnを示している。
+	// 子メソッドを呼び出す時はこの位置を維持する。子メソッドから戻ったら06hの分のPC++を行う。
+	uint8_t vv = m_pMemSys->Read(m_R.PC+1);
+	m_Clock.AddTStates(Z80TS_DDCB[vv]);
+	auto pFunc = OpCode_Extended2IX2[vv].pFunc;
+	(this->*pFunc)();
+	m_R.PC++;
 	return;
 }
-void CZ80MsxDos::op_ADD_A_L()
+void CZ80MsxDos::op_EX_memSP_IX()
 {
-	m_R.Add8(&m_R.A, m_R.L);
+	uint8_t ixl = (m_R.IX >> 0) & 0xFF;
+	uint8_t ixh = (m_R.IX >> 8) & 0xFF;
+	m_R.IX = m_pMemSys->Read(m_R.SP+0);
+	m_R.IX |= static_cast<uint16_t>(m_pMemSys->Read(m_R.SP+1)) < 8;;
+	m_pMemSys->Write(m_R.SP+0, ixl);
+	m_pMemSys->Write(m_R.SP+1, ixh);
 	return;
 }
-void CZ80MsxDos::op_ADD_A_memHL()
+
+// extended2 for IX - 2
+
+// extended3 - for debug
+void CZ80MsxDos::op_DEBUGBREAK()
 {
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8(&m_R.A, v);
+	DEBUG_BREAK;
 	return;
+
 }
-void CZ80MsxDos::op_ADD_A_A()
+
+// extended3
+void CZ80MsxDos::op_SBC_HL_BC()
 {
-	m_R.Add8(&m_R.A, m_R.A);
+	uint16_t v = m_R.GetHL();
+	m_R.Sub16Cy(&v, m_R.GetBC(), m_R.F.C);
+	m_R.SetHL(v);
 	return;
 }
-void CZ80MsxDos::op_ADC_A_B()
+void CZ80MsxDos::op_LD_memAD_BC()
 {
-	m_R.Add8Cy(&m_R.A, m_R.B, m_R.F.C);
+	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	m_pMemSys->Write(ad+0, m_R.C);
+	m_pMemSys->Write(ad+1, m_R.B);
 	return;
 }
-void CZ80MsxDos::op_ADC_A_C()
+void CZ80MsxDos::op_NEG()
 {
-	m_R.Add8Cy(&m_R.A, m_R.C, m_R.F.C);
+	if( m_R.A == 0 )
+	{
+		m_R.F.C = 0;
+		m_R.F.Z = 1;
+		m_R.F.PV= 0;
+		m_R.F.S = 0;
+		m_R.F.N = 1;
+		m_R.F.H = 0;
+	}
+	else{
+		m_R.A = (0 - m_R.A) & 0xFF;
+		//
+		m_R.F.C = 1;
+		m_R.F.Z = 0;
+		m_R.F.PV= 0;
+		m_R.F.S = (m_R.A>>7)&0x1;
+		m_R.F.N = 1;
+		m_R.F.H = 1;
+	}
 	return;
 }
-void CZ80MsxDos::op_ADC_A_D()
+void CZ80MsxDos::op_RETN()
 {
-	m_R.Add8Cy(&m_R.A, m_R.D, m_R.F.C);
+	m_R.PC = m_pMemSys->Read(m_R.SP++);
+	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	m_bIFF1 = m_bIFF2;
 	return;
 }
-void CZ80MsxDos::op_ADC_A_E()
+void CZ80MsxDos::op_IM_0()
 {
-	m_R.Add8Cy(&m_R.A, m_R.E, m_R.F.C);
+	m_IM = INTERRUPTMODE0;
 	return;
 }
-void CZ80MsxDos::op_ADC_A_H()
+void CZ80MsxDos::op_LD_i_A()
 {
-	m_R.Add8Cy(&m_R.A, m_R.H, m_R.F.C);
+	m_R.I = m_R.A;
 	return;
 }
-void CZ80MsxDos::op_ADC_A_L()
+void CZ80MsxDos::op_ADC_HL_BC()
 {
-	m_R.Add8Cy(&m_R.A, m_R.L, m_R.F.C);
+	uint16_t v = m_R.GetHL();
+	m_R.Add16Cy(&v, m_R.GetBC(), m_R.F.C);
+	m_R.SetHL(v);
 	return;
 }
-void CZ80MsxDos::op_ADC_A_memHL()
+void CZ80MsxDos::op_LD_BC_memAD()
 {
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8Cy(&m_R.A, v, m_R.F.C);
+	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	m_R.C = m_pMemSys->Read(ad+0);
+	m_R.B = m_pMemSys->Read(ad+1);
 	return;
 }
-void CZ80MsxDos::op_ADC_A_A()
+void CZ80MsxDos::op_RETI()
 {
-	m_R.Add8Cy(&m_R.A, m_R.A, m_R.F.C);
+	m_R.PC = m_pMemSys->Read(m_R.SP++);
+	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
+	m_bIFF1 = m_bIFF2;
 	return;
 }
-void CZ80MsxDos::op_SUB_B()
+void CZ80MsxDos::op_LD_R_A()
 {
-	m_R.Sub8(&m_R.A, m_R.B);
+	m_R.R = m_R.A;
 	return;
 }
-void CZ80MsxDos::op_SUB_C()
+void CZ80MsxDos::op_SBC_HL_DE()
 {
-	m_R.Sub8(&m_R.A, m_R.C);
+	uint16_t v = m_R.GetHL();
+	m_R.Sub16Cy(&v, m_R.GetDE(), m_R.F.C);
+	m_R.SetHL(v);
 	return;
 }
-void CZ80MsxDos::op_SUB_D()
+void CZ80MsxDos::op_LD_memAD_DE()
 {
-	m_R.Sub8(&m_R.A, m_R.D);
+	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	m_pMemSys->Write(ad+0, m_R.E);
+	m_pMemSys->Write(ad+1, m_R.D);
 	return;
 }
-void CZ80MsxDos::op_SUB_E()
+void CZ80MsxDos::op_IM_1()
 {
-	m_R.Sub8(&m_R.A, m_R.E);
+	m_IM = INTERRUPTMODE1;
 	return;
 }
-void CZ80MsxDos::op_SUB_H()
+void CZ80MsxDos::op_LD_A_i()
 {
-	m_R.Sub8(&m_R.A, m_R.H);
+	m_R.A = m_R.I;
+	//
+	m_R.F.C = m_R.F.C;
+	m_R.F.Z = (m_R.A==0)?1:0;
+	m_R.F.PV = (m_bIFF2)?1:0;
+	m_R.F.S = (m_R.A>>7)&0x01;
+	m_R.F.N = 0;
+	m_R.F.H = 0;
 	return;
 }
-void CZ80MsxDos::op_SUB_L()
+void CZ80MsxDos::op_ADC_HL_DE()
 {
-	m_R.Sub8(&m_R.A, m_R.L);
+	uint16_t v = m_R.GetHL();
+	m_R.Add16Cy(&v, m_R.GetDE(), m_R.F.C);
+	m_R.SetHL(v);
 	return;
 }
-void CZ80MsxDos::op_SUB_memHL()
+void CZ80MsxDos::op_LD_DE_memAD()
 {
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8(&m_R.A, v);
+	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
+	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
+	m_R.E = m_pMemSys->Read(ad+0);
+	m_R.D = m_pMemSys->Read(ad+1);
 	return;
 }
-void CZ80MsxDos::op_SUB_A()
+void CZ80MsxDos::op_IM_2()
 {
-	m_R.Sub8(&m_R.A, m_R.A);
+	m_IM = INTERRUPTMODE2;
 	return;
 }
-void CZ80MsxDos::op_SBC_A_B()
+void CZ80MsxDos::op_LD_A_R()
 {
-	m_R.Sub8Cy(&m_R.A, m_R.B, m_R.F.C);
+	m_R.A = m_R.R;
+	//
+	m_R.F.C = m_R.F.C;
+	m_R.F.Z = (m_R.A==0)?1:0;
+	m_R.F.PV = (m_bIFF2)?1:0;
+	m_R.F.S = (m_R.A>>7)&0x01;
+	m_R.F.N = 0;
+	m_R.F.H = 0;
 	return;
 }
-void CZ80MsxDos::op_SBC_A_C()
+void CZ80MsxDos::op_SBC_HL_HL()
 {
-	m_R.Sub8Cy(&m_R.A, m_R.C, m_R.F.C);
+	uint16_t v = m_R.GetHL();
+	m_R.Sub16Cy(&v, v, m_R.F.C);
+	m_R.SetHL(v);
 	return;
 }
-void CZ80MsxDos::op_SBC_A_D()
-{
-	m_R.Sub8Cy(&m_R.A, m_R.D, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_E()
-{
-	m_R.Sub8Cy(&m_R.A, m_R.E, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_H()
-{
-	m_R.Sub8Cy(&m_R.A, m_R.H, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_L()
-{
-	m_R.Sub8Cy(&m_R.A, m_R.L, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SBC_A()
-{
-	m_R.Sub8Cy(&m_R.A, m_R.A, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_AND_B()
-{
-	m_R.And8(&m_R.A, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_AND_C()
-{
-	m_R.And8(&m_R.A, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_AND_D()
-{
-	m_R.And8(&m_R.A, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_AND_E()
-{
-	m_R.And8(&m_R.A, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_AND_H()
-{
-	m_R.And8(&m_R.A, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_AND_L()
-{
-	m_R.And8(&m_R.A, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_AND_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.And8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_AND_A()
-{
-	m_R.And8(&m_R.A, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_XOR_B()
-{
-	m_R.Xor8(&m_R.A, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_XOR_C()
-{
-	m_R.Xor8(&m_R.A, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_XOR_D()
-{
-	m_R.Xor8(&m_R.A, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_XOR_E()
-{
-	m_R.Xor8(&m_R.A, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_XOR_H()
-{
-	m_R.Xor8(&m_R.A, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_XOR_L()
-{
-	m_R.Xor8(&m_R.A, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_XOR_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Xor8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_XOR_A()
-{
-	m_R.Xor8(&m_R.A, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_OR_B()
-{
-	m_R.Or8(&m_R.A, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_OR_C()
-{
-	m_R.Or8(&m_R.A, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_OR_D()
-{
-	m_R.Or8(&m_R.A, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_OR_E()
-{
-	m_R.Or8(&m_R.A, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_OR_H()
-{
-	m_R.Or8(&m_R.A, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_OR_L()
-{
-	m_R.Or8(&m_R.A, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_OR_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Or8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_OR_A()
-{
-	m_R.Or8(&m_R.A, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_CP_B()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_CP_C()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_CP_D()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_CP_E()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_CP_H()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_CP_L()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_CP_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, v);
-	return;
-}
-void CZ80MsxDos::op_CP_A()
-{
-	uint8_t temp = m_R.A;
-	m_R.Sub8(&temp, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_RET_nz()
-{
-	if( m_R.F.Z == 0 ){
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_POP_BC()
-{
-	m_R.C = m_pMemSys->Read(m_R.SP++);
-	m_R.B = m_pMemSys->Read(m_R.SP++);
-	return;
-}
-void CZ80MsxDos::op_JP_nz_ad()
-{
-	if( m_R.F.Z == 0 ){
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_JP_ad()
-{
-	uint16_t temp = m_pMemSys->Read(m_R.PC++);
-	temp |= m_pMemSys->Read(m_R.PC) << 8;
-	m_R.PC = temp;
-	return;
-}
-void CZ80MsxDos::op_CALL_nz_ad()
-{
-	if( m_R.F.Z == 0 ){
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_PUSH_BC()
-{
-	m_pMemSys->Write(--m_R.SP, m_R.B);
-	m_pMemSys->Write(--m_R.SP, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_ADD_A_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Add8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_RST_0h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x00;
-	return;
-}
-void CZ80MsxDos::op_RET_z()
-{
-	if( m_R.F.Z != 0 ){
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_RET()
-{
-	m_R.PC = m_pMemSys->Read(m_R.SP++);
-	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	return;
-}
-void CZ80MsxDos::op_JP_z_ad()
-{
-	if( m_R.F.Z != 0 ){
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_EXTENDED_1()
-{
-	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
-	auto pFunc = OpCode_Extended1[opcd].pFunc;
-	(this->*pFunc)();
-	return;
-}
-void CZ80MsxDos::op_CALL_z_ad()
-{
-	if( m_R.F.Z != 0 ){
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_CALL_ad()
-{
-	uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-	destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = destAddr;
-	return;
-}
-void CZ80MsxDos::op_ADC_A_v()
-{
-	uint8_t v= m_pMemSys->Read(m_R.PC++);
-	m_R.Add8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_RST_8h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x08;
-	return;
-}
-void CZ80MsxDos::op_RET_nc()
-{
-	if( m_R.F.C == 0 ){
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_POP_DE()
-{
-	m_R.E = m_pMemSys->Read(m_R.SP++);
-	m_R.D = m_pMemSys->Read(m_R.SP++);
-	return;
-}
-void CZ80MsxDos::op_JP_nc_ad()
-{
-	if( m_R.F.C == 0 ){
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_OUT_memv_A()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_pIoSys->Out(v, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_CALL_nc_ad()
-{
-	if( m_R.F.C == 0 ){
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_PUSH_DE()
-{
-	m_pMemSys->Write(--m_R.SP, m_R.D);
-	m_pMemSys->Write(--m_R.SP, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_SUB_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Sub8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_RST_10h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x10;
-	return;
-}
-void CZ80MsxDos::op_RET_c()
-{
-	if( m_R.F.C != 0 ){
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_EXX()
-{
-	m_R.Exchange();
-	return;
-}
-void CZ80MsxDos::op_JP_c_ad()
-{
-	if( m_R.F.C != 0 ){
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_IN_A_memv()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.A = m_pIoSys->In(v);
-	return;
-}
-void CZ80MsxDos::op_CALL_c_ad()
-{
-	if( m_R.F.C != 0 ){
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_EXTENDED_2IX()
-{
-	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
-	auto pFunc = OpCode_Extended2IX[opcd].pFunc;
-	(this->*pFunc)();
-	return;
-}
-void CZ80MsxDos::op_SBC_A_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Sub8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_RST_18h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x18;
-	return;
-}
-void CZ80MsxDos::op_RET_po()
-{
-	if( m_R.F.PV == 0 ){	// PO
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_POP_HL()
-{
-	m_R.L = m_pMemSys->Read(m_R.SP++);
-	m_R.H = m_pMemSys->Read(m_R.SP++);
-	return;
-}
-void CZ80MsxDos::op_JP_po_ad()
-{
-	if( m_R.F.PV == 0 ){
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_EX_memSP_HL()
-{
-	uint8_t rl = m_R.L, rh = m_R.H;
-	m_R.L = m_pMemSys->Read(m_R.SP+0);
-	m_R.H = m_pMemSys->Read(m_R.SP+1);
-	m_pMemSys->Write(m_R.SP+0, rl);
-	m_pMemSys->Write(m_R.SP+1, rh);
-	return;
-}
-void CZ80MsxDos::op_CALL_po_ad()
-{
-	if( m_R.F.PV == 0 ){
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_PUSH_HL()
-{
-	m_pMemSys->Write(--m_R.SP, m_R.H);
-	m_pMemSys->Write(--m_R.SP, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_AND_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.And8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_RST_20h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x20;
-	return;
-}
-void CZ80MsxDos::op_RET_pe()
-{
-	if( m_R.F.PV != 0 ){	// PE
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_JP_memHL()
-{
-	m_R.PC = m_R.GetHL();	// HLの値そのものがアドレス値である。
-	return;
-}
-
-void CZ80MsxDos::op_JP_pe_ad()
-{
-	if( m_R.F.PV != 0 ){ // PE
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_EX_DE_HL()
-{
-	uint16_t temp = m_R.GetDE();
-	m_R.SetDE(m_R.GetHL());
-	m_R.SetHL(temp);
-	return;
-}
-void CZ80MsxDos::op_CALL_pe_ad()
-{
-	if( m_R.F.PV != 0 ){ // PE
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_EXTENDED_3()
-{
-	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
-	auto pFunc = OpCode_Extended3[opcd].pFunc;
-	(this->*pFunc)();
-	return;
-}
-void CZ80MsxDos::op_XOR_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Xor8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_RST_28h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x28;
-	return;
-}
-void CZ80MsxDos::op_RET_p()
-{
-	if( m_R.F.S == 0 ){	// P
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_POP_AF()
-{
-	m_R.F.Set(m_pMemSys->Read(m_R.SP++));
-	m_R.A = m_pMemSys->Read(m_R.SP++);
-	return;
-}
-void CZ80MsxDos::op_JP_p_ad()
-{
-	if( m_R.F.S == 0 ){ // P
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_DI()
-{
-	m_bIFF1 = m_bIFF2 = false;
-	return;
-}
-void CZ80MsxDos::op_CALL_p_ad()
-{
-	if( m_R.F.S == 0 ){ // P
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_PUSH_AF()
-{
-	m_pMemSys->Write(--m_R.SP, m_R.A);
-	m_pMemSys->Write(--m_R.SP, m_R.F.Get());
-	return;
-}
-void CZ80MsxDos::op_OR_v()
-{
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Or8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_RST_30h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x30;
-	return;
-}
-void CZ80MsxDos::op_RET_m()
-{
-	if( m_R.F.S != 0 ){	// M
-		m_R.PC = m_pMemSys->Read(m_R.SP++);
-		m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	}
-	return;
-}
-void CZ80MsxDos::op_LD_SP_HL()
-{
-	m_R.SP = m_R.GetHL();
-	return;
-}
-void CZ80MsxDos::op_JP_m_ad()
-{
-	if( m_R.F.S != 0 ){ // M
-		uint16_t temp = m_pMemSys->Read(m_R.PC++);
-		temp |= m_pMemSys->Read(m_R.PC) << 8;
-		m_R.PC = temp;
-	}
-	else{
-		m_R.PC += 2;	// nnを読み捨て
-	}
-	return;
-}
-void CZ80MsxDos::op_EI()
-{
-	m_bIFF1 = m_bIFF2 = true;
-	return;
-}
-void CZ80MsxDos::op_CALL_m_ad()
-{
-	if( m_R.F.S != 0 ){ // M
-		uint16_t destAddr = m_pMemSys->Read(m_R.PC++);
-		destAddr |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-		m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-		m_R.PC = destAddr;
-	}
-	else{
-		m_R.PC += 2;
-	}
-	return;
-}
-void CZ80MsxDos::op_EXTENDED_4IY()
-{
-	uint8_t opcd = m_pMemSys->Read(m_R.PC++);
-	auto pFunc = OpCode_Extended4IY[opcd].pFunc;
-	(this->*pFunc)();
-	return;
-}
-void CZ80MsxDos::op_CP_v()
-{
-	uint8_t tempA = m_R.A;
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_R.Sub8(&tempA, v);
-	return;
-}
-void CZ80MsxDos::op_RST_38h()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>8)&0xff);
-	m_pMemSys->Write(--m_R.SP, (m_R.PC>>0)&0xff);
-	m_R.PC = 0x38;
-	return;
-}
-
-// extended1
-void CZ80MsxDos::op_RLC_B()
-{
-	m_R.Rlc8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_RLC_C()
-{
-	m_R.Rlc8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_RLC_D()
-{
-	m_R.Rlc8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_RLC_E()
-{
-	m_R.Rlc8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_RLC_H()
-{
-	m_R.Rlc8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_RLC_L()
-{
-	m_R.Rlc8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_RLC_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rlc8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RLC_A()
-{
-	m_R.Rlc8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_RRC_B()
-{
-	m_R.Rrc8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_RRC_C()
-{
-	m_R.Rrc8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_RRC_D()
-{
-	m_R.Rrc8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_RRC_E()
-{
-	m_R.Rrc8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_RRC_H()
-{
-	m_R.Rrc8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_RRC_L()
-{
-	m_R.Rrc8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_RRC_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rrc8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RRC_A()
-{
-	m_R.Rrc8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_RL_B()
-{
-	m_R.Rl8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_RL_C()
-{
-	m_R.Rl8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_RL_D()
-{
-	m_R.Rl8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_RL_E()
-{
-	m_R.Rl8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_RL_H()
-{
-	m_R.Rl8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_RL_L()
-{
-	m_R.Rl8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_RL_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rl8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RL_A()
-{
-	m_R.Rl8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_RR_B()
-{
-	m_R.Rr8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_RR_C()
-{
-	m_R.Rr8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_RR_D()
-{
-	m_R.Rr8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_RR_E()
-{
-	m_R.Rr8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_RR_H()
-{
-	m_R.Rr8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_RR_L()
-{
-	m_R.Rr8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_RR_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rr8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RR_A()
-{
-	m_R.Rr8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_SLA_B()
-{
-	m_R.Sla8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_SLA_C()
-{
-	m_R.Sla8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_SLA_D()
-{
-	m_R.Sla8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_SLA_E()
-{
-	m_R.Sla8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_SLA_H()
-{
-	m_R.Sla8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_SLA_L()
-{
-	m_R.Sla8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_SLA_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sla8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SLA_A()
-{
-	m_R.Sla8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_SRA_B()
-{
-	m_R.Sra8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_SRA_C()
-{
-	m_R.Sra8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_SRA_D()
-{
-	m_R.Sra8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_SRA_E()
-{
-	m_R.Sra8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_SRA_H()
-{
-	m_R.Sra8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_SRA_L()
-{
-	m_R.Sra8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_SRA_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sra8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SRA_A()
-{
-	m_R.Sra8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_SLL_B()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_SLL_C()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_SLL_D()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_SLL_E()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_SLL_H()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_SLL_L()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_SLL_memHL()	// undoc.Z80
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sll8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SLL_A()	// undoc.Z80
-{
-	m_R.Sll8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_SRL_B()
-{
-	m_R.Srl8(&m_R.B);
-	return;
-}
-void CZ80MsxDos::op_SRL_C()
-{
-	m_R.Srl8(&m_R.C);
-	return;
-}
-void CZ80MsxDos::op_SRL_D()
-{
-	m_R.Srl8(&m_R.D);
-	return;
-}
-void CZ80MsxDos::op_SRL_E()
-{
-	m_R.Srl8(&m_R.E);
-	return;
-}
-void CZ80MsxDos::op_SRL_H()
-{
-	m_R.Srl8(&m_R.H);
-	return;
-}
-void CZ80MsxDos::op_SRL_L()
-{
-	m_R.Srl8(&m_R.L);
-	return;
-}
-void CZ80MsxDos::op_SRL_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Srl8(&v);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SRL_A()
-{
-	m_R.Srl8(&m_R.A);
-	return;
-}
-void CZ80MsxDos::op_BIT_0_B()
-{
-	m_R.F.Z = (m_R.B & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_C()
-{
-	m_R.F.Z = (m_R.C & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_D()
-{
-	m_R.F.Z = (m_R.D & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_E()
-{
-	m_R.F.Z = (m_R.E & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_H()
-{
-	m_R.F.Z = (m_R.H & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_L()
-{
-	m_R.F.Z = (m_R.L & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = (v & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_0_A()
-{
-	m_R.F.Z = (m_R.A & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_B()
-{
-	m_R.F.Z = ((m_R.B>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_C()
-{
-	m_R.F.Z = ((m_R.C>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_D()
-{
-	m_R.F.Z = ((m_R.D>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_E()
-{
-	m_R.F.Z = ((m_R.E>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_H()
-{
-	m_R.F.Z = ((m_R.H>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_L()
-{
-	m_R.F.Z = ((m_R.L>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_A()
-{
-	m_R.F.Z = ((m_R.A>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_B()
-{
-	m_R.F.Z = ((m_R.B>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_C()
-{
-	m_R.F.Z = ((m_R.C>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_D()
-{
-	m_R.F.Z = ((m_R.D>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_E()
-{
-	m_R.F.Z = ((m_R.E>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_H()
-{
-	m_R.F.Z = ((m_R.H>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_L()
-{
-	m_R.F.Z = ((m_R.L>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_A()
-{
-	m_R.F.Z = ((m_R.A>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_B()
-{
-	m_R.F.Z = ((m_R.B>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_C()
-{
-	m_R.F.Z = ((m_R.C>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_D()
-{
-	m_R.F.Z = ((m_R.D>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_E()
-{
-	m_R.F.Z = ((m_R.E>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_H()
-{
-	m_R.F.Z = ((m_R.H>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_L()
-{
-	m_R.F.Z = ((m_R.L>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_A()
-{
-	m_R.F.Z = ((m_R.A>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_B()
-{
-	m_R.F.Z = ((m_R.B>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_C()
-{
-	m_R.F.Z = ((m_R.C>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_D()
-{
-	m_R.F.Z = ((m_R.D>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_E()
-{
-	m_R.F.Z = ((m_R.E>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_H()
-{
-	m_R.F.Z = ((m_R.H>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_L()
-{
-	m_R.F.Z = ((m_R.L>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_A()
-{
-	m_R.F.Z = ((m_R.A>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_B()
-{
-	m_R.F.Z = ((m_R.B>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_C()
-{
-	m_R.F.Z = ((m_R.C>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_D()
-{
-	m_R.F.Z = ((m_R.D>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_E()
-{
-	m_R.F.Z = ((m_R.E>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_H()
-{
-	m_R.F.Z = ((m_R.H>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_L()
-{
-	m_R.F.Z = ((m_R.L>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_A()
-{
-	m_R.F.Z = ((m_R.A>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_B()
-{
-	m_R.F.Z = ((m_R.B>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_C()
-{
-	m_R.F.Z = ((m_R.C>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_D()
-{
-	m_R.F.Z = ((m_R.D>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_E()
-{
-	m_R.F.Z = ((m_R.E>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_H()
-{
-	m_R.F.Z = ((m_R.H>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_L()
-{
-	m_R.F.Z = ((m_R.L>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_A()
-{
-	m_R.F.Z = ((m_R.A>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_B()
-{
-	m_R.F.Z = ((m_R.B>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_C()
-{
-	m_R.F.Z = ((m_R.C>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_D()
-{
-	m_R.F.Z = ((m_R.D>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_E()
-{
-	m_R.F.Z = ((m_R.E>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_H()
-{
-	m_R.F.Z = ((m_R.H>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_L()
-{
-	m_R.F.Z = ((m_R.L>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_A()
-{
-	m_R.F.Z = ((m_R.A>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_RES_0_B()
-{
-	m_R.B &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_C()
-{
-	m_R.C &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_D()
-{
-	m_R.D &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_E()
-{
-	m_R.E &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_H()
-{
-	m_R.H &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_L()
-{
-	m_R.L &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_0_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 0) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_0_A()
-{
-	m_R.A &= ((0x01 << 0) ^ 0xFF);
-	return;
-}
-
-void CZ80MsxDos::op_RES_1_B()
-{
-	m_R.B &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_C()
-{
-	m_R.C &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_D()
-{
-	m_R.D &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_E()
-{
-	m_R.E &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_H()
-{
-	m_R.H &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_L()
-{
-	m_R.L &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_1_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 1) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_1_A()
-{
-	m_R.A &= ((0x01 << 1) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_B()
-{
-	m_R.B &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_C()
-{
-	m_R.C &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_D()
-{
-	m_R.D &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_E()
-{
-	m_R.E &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_H()
-{
-	m_R.H &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_L()
-{
-	m_R.L &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_2_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 2) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_2_A()
-{
-	m_R.A &= ((0x01 << 2) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_B()
-{
-	m_R.B &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_C()
-{
-	m_R.C &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_D()
-{
-	m_R.D &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_E()
-{
-	m_R.E &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_H()
-{
-	m_R.H &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_L()
-{
-	m_R.L &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_3_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 3) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_3_A()
-{
-	m_R.A &= ((0x01 << 3) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_B()
-{
-	m_R.B &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_C()
-{
-	m_R.C &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_D()
-{
-	m_R.D &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_E()
-{
-	m_R.E &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_H()
-{
-	m_R.H &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_L()
-{
-	m_R.L &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_4_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 4) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_4_A()
-{
-	m_R.A &= ((0x01 << 4) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_B()
-{
-	m_R.B &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_C()
-{
-	m_R.C &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_D()
-{
-	m_R.D &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_E()
-{
-	m_R.E &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_H()
-{
-	m_R.H &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_L()
-{
-	m_R.L &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_5_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 5) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_5_A()
-{
-	m_R.A &= ((0x01 << 5) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_B()
-{
-	m_R.B &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_C()
-{
-	m_R.C &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_D()
-{
-	m_R.D &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_E()
-{
-	m_R.E &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_H()
-{
-	m_R.H &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_L()
-{
-	m_R.L &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_6_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 6) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_6_A()
-{
-	m_R.A &= ((0x01 << 6) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_B()
-{
-	m_R.B &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_C()
-{
-	m_R.C &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_D()
-{
-	m_R.D &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_E()
-{
-	m_R.E &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_H()
-{
-	m_R.H &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_L()
-{
-	m_R.L &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_RES_7_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 7) ^ 0xFF);
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_RES_7_A()
-{
-	m_R.A &= ((0x01 << 7) ^ 0xFF);
-	return;
-}
-void CZ80MsxDos::op_SET_0_B()
-{
-	m_R.B |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_C()
-{
-	m_R.C |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_D()
-{
-	m_R.D |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_E()
-{
-	m_R.E |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_H()
-{
-	m_R.H |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_L()
-{
-	m_R.L |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_0_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 0;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_0_A()
-{
-	m_R.A |= 0x01 << 0;
-	return;
-}
-void CZ80MsxDos::op_SET_1_B()
-{
-	m_R.B |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_C()
-{
-	m_R.C |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_D()
-{
-	m_R.D |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_E()
-{
-	m_R.E |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_H()
-{
-	m_R.H |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_L()
-{
-	m_R.L |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_1_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 1;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_1_A()
-{
-	m_R.A |= 0x01 << 1;
-	return;
-}
-void CZ80MsxDos::op_SET_2_B()
-{
-	m_R.B |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_C()
-{
-	m_R.C |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_D()
-{
-	m_R.D |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_E()
-{
-	m_R.E |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_H()
-{
-	m_R.H |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_L()
-{
-	m_R.L |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_2_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 2;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_2_A()
-{
-	m_R.A |= 0x01 << 2;
-	return;
-}
-void CZ80MsxDos::op_SET_3_B()
-{
-	m_R.B |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_C()
-{
-	m_R.C |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_D()
-{
-	m_R.D |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_E()
-{
-	m_R.E |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_H()
-{
-	m_R.H |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_L()
-{
-	m_R.L |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_3_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 3;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_3_A()
-{
-	m_R.A |= 0x01 << 3;
-	return;
-}
-void CZ80MsxDos::op_SET_4_B()
-{
-	m_R.B |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_C()
-{
-	m_R.C |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_D()
-{
-	m_R.D |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_E()
-{
-	m_R.E |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_H()
-{
-	m_R.H |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_L()
-{
-	m_R.L |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_4_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 4;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_4_A()
-{
-	m_R.A |= 0x01 << 4;
-	return;
-}
-void CZ80MsxDos::op_SET_5_B()
-{
-	m_R.B |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_C()
-{
-	m_R.C |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_D()
-{
-	m_R.D |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_E()
-{
-	m_R.E |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_H()
-{
-	m_R.H |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_L()
-{
-	m_R.L |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_5_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 5;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_5_A()
-{
-	m_R.A |= 0x01 << 5;
-	return;
-}
-void CZ80MsxDos::op_SET_6_B()
-{
-	m_R.B |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_C()
-{
-	m_R.C |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_D()
-{
-	m_R.D |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_E()
-{
-	m_R.E |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_H()
-{
-	m_R.H |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_L()
-{
-	m_R.L |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_6_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 6;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_6_A()
-{
-	m_R.A |= 0x01 << 6;
-	return;
-}
-void CZ80MsxDos::op_SET_7_B()
-{
-	m_R.B |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_C()
-{
-	m_R.C |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_D()
-{
-	m_R.D |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_E()
-{
-	m_R.E |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_H()
-{
-	m_R.H |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_L()
-{
-	m_R.L |= 0x01 << 7;
-	return;
-}
-void CZ80MsxDos::op_SET_7_memHL()
-{
-	uint16_t ad = m_R.GetHL();
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 7;
-	m_pMemSys->Write(m_R.GetHL(), v);
-	return;
-}
-void CZ80MsxDos::op_SET_7_A()
-{
-	m_R.A |= 0x01 << 7;
-	return;
-}
-
-// extended2 for IX
-void CZ80MsxDos::op_ADD_IX_BC()
-{
-	m_R.Add16(&m_R.IX, m_R.GetBC());
-	return;
-}
-void CZ80MsxDos::op_ADD_IX_DE()
-{
-	m_R.Add16(&m_R.IX, m_R.GetDE());
-	return;
-}
-void CZ80MsxDos::op_LD_IX_ad()
-{
-	m_R.IX = m_pMemSys->Read(m_R.PC++);
-	m_R.IX |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	return;
-}
-void CZ80MsxDos::op_LD_memAD_IX()
-{
-	uint16_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	//
-	m_pMemSys->Write(ad+0, (m_R.IX>>0)&0xff);
-	m_pMemSys->Write(ad+1, (m_R.IX>>8)&0xff);
-	return;
-}
-void CZ80MsxDos::op_INC_IX()
-{
-	++m_R.IX;
-	return;
-}
-void CZ80MsxDos::op_ADD_IX_IX()
-{
-	m_R.Add16(&m_R.IX, m_R.IX);
-	return;
-}
-void CZ80MsxDos::op_LD_IX_memAD()
-{
-	uint16_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	//
-	m_R.IX = m_pMemSys->Read(ad + 0);
-	m_R.IX |= static_cast<uint16_t>(m_pMemSys->Read(ad + 1)) << 8;
-	return;
-}
-void CZ80MsxDos::op_DEC_IX()
-{
-	--m_R.IX;
-	return;
-}
-void CZ80MsxDos::op_INC_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Inc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_DEC_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Dec8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_v()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_ADD_IX_SP()
-{
-	m_R.Add16(&m_R.IX, m_R.SP);
-	return;
-}
-void CZ80MsxDos::op_LD_B_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.B = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_C_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.C = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_D_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.D = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_E_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.E = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_H_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.H = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_L_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.L = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_B()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_C()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_D()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_E()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_H()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_L()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_LD_memIXpV_A()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.A);
-	return;
-}
-void CZ80MsxDos::op_LD_A_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	m_R.A = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_ADD_A_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_ADC_A_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SUB_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_AND_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.And8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_XOR_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Xor8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_OR_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Or8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_CP_memIXpV()
-{
-	uint16_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	uint8_t tempA = m_R.A;
-	m_R.Sub8(&tempA, v);
-	return;
-}
-void CZ80MsxDos::op_EXTENDED_2IX2()
-{
-	// このマシンコードは、DDh+CBh+nn+vv の形式になっていて、
-	// データ部nnがコードの途中に位置していることに注意する
-	// このメソッドが呼ばれた時点で、DDh+CBhまではデコードされているからPCの位置はnnを示している。
-	// 子メソッドを呼び出す時はこの位置を維持する。子メソッドから戻ったら06hの分のPC++を行う。
-	uint8_t vv = m_pMemSys->Read(m_R.PC+1);
-	auto pFunc = OpCode_Extended2IX2[vv].pFunc;
-	(this->*pFunc)();
-	m_R.PC++;
-	return;
-}
-void CZ80MsxDos::op_POP_IX()
-{
-	m_R.IX = m_pMemSys->Read(m_R.SP++);
-	m_R.IX |= static_cast<uint16_t>(m_pMemSys->Read(m_R.SP++)) << 8;
-	return;
-}
-void CZ80MsxDos::op_EX_memSP_IX()
-{
-	uint8_t ixl = (m_R.IX >> 0) & 0xFF;
-	uint8_t ixh = (m_R.IX >> 8) & 0xFF;
-	m_R.IX = m_pMemSys->Read(m_R.SP+0);
-	m_R.IX |= static_cast<uint16_t>(m_pMemSys->Read(m_R.SP+1)) < 8;;
-	m_pMemSys->Write(m_R.SP+0, ixl);
-	m_pMemSys->Write(m_R.SP+1, ixh);
-	return;
-}
-void CZ80MsxDos::op_PUSH_IX()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.IX>>8)&0xFF);
-	m_pMemSys->Write(--m_R.SP, (m_R.IX>>0)&0xFF);
-	return;
-}
-void CZ80MsxDos::op_JP_memIX()
-{
-	m_R.PC = m_R.IX;	// IXの値そのものがアドレス値である
-	return;
-}
-void CZ80MsxDos::op_LD_SP_IX()
-{
-	m_R.SP = m_R.IX;
-	return;
-}
-
-// extended2 for IX - 2
-void CZ80MsxDos::op_RLC_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rlc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RRC_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rrc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RL_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rl8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RR_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rr8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SLA_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sla8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SRA_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sra8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SRL_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Srl8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_BIT_0_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = (v & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_RES_0_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 0) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_1_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 1) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_2_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 2) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_3_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 3) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_4_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 4) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_5_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 5) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_6_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 6) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_7_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 7) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_0_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 0;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_1_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 1;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_2_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 2;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_3_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 3;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_4_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 4;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_5_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 5;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_6_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 6;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_7_memVpIX()
-{
-	z80memaddr_t ad = m_R.IX + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 7;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-
-// extended3 - for debug
-void CZ80MsxDos::op_DEBUGBREAK()
-{
-	DEBUG_BREAK;
-	return;
-
-}
-
-// extended3
-void CZ80MsxDos::op_IN_B_memC()
-{
-	// ※Bレジスタによる16bitアドレスは考慮しない。
-	m_R.B = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.B);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_B()
-{
-	m_pIoSys->Out(m_R.C, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_SBC_HL_BC()
-{
-	uint16_t v = m_R.GetHL();
-	m_R.Sub16Cy(&v, m_R.GetBC(), m_R.F.C);
-	m_R.SetHL(v);
-	return;
-}
-void CZ80MsxDos::op_LD_memAD_BC()
-{
-	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	m_pMemSys->Write(ad+0, m_R.C);
-	m_pMemSys->Write(ad+1, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_NEG()
-{
-	if( m_R.A == 0 )
-	{
-		m_R.F.C = 0;
-		m_R.F.Z = 1;
-		m_R.F.PV= 0;
-		m_R.F.S = 0;
-		m_R.F.N = 1;
-		m_R.F.H = 0;
-	}
-	else{
-		m_R.A = (0 - m_R.A) & 0xFF;
-		//
-		m_R.F.C = 1;
-		m_R.F.Z = 0;
-		m_R.F.PV= 0;
-		m_R.F.S = (m_R.A>>7)&0x1;
-		m_R.F.N = 1;
-		m_R.F.H = 1;
-	}
-	return;
-}
-void CZ80MsxDos::op_RETN()
-{
-	m_R.PC = m_pMemSys->Read(m_R.SP++);
-	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	m_bIFF1 = m_bIFF2;
-	return;
-}
-void CZ80MsxDos::op_IM_0()
-{
-	m_IM = INTERRUPTMODE0;
-	return;
-}
-void CZ80MsxDos::op_LD_i_A()
-{
-	m_R.I = m_R.A;
-	return;
-}
-void CZ80MsxDos::op_IN_C_memC()
-{
-	m_R.C = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.C);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_C()
-{
-	m_pIoSys->Out(m_R.C, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_ADC_HL_BC()
-{
-	uint16_t v = m_R.GetHL();
-	m_R.Add16Cy(&v, m_R.GetBC(), m_R.F.C);
-	m_R.SetHL(v);
-	return;
-}
-void CZ80MsxDos::op_LD_BC_memAD()
-{
-	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	m_R.C = m_pMemSys->Read(ad+0);
-	m_R.B = m_pMemSys->Read(ad+1);
-	return;
-}
-void CZ80MsxDos::op_RETI()
-{
-	m_R.PC = m_pMemSys->Read(m_R.SP++);
-	m_R.PC |= m_pMemSys->Read(m_R.SP++) << 8;
-	m_bIFF1 = m_bIFF2;
-	return;
-}
-void CZ80MsxDos::op_LD_R_A()
-{
-	m_R.R = m_R.A;
-	return;
-}
-void CZ80MsxDos::op_IN_D_memC()
-{
-	m_R.D = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.D);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_D()
-{
-	m_pIoSys->Out(m_R.C, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_SBC_HL_DE()
-{
-	uint16_t v = m_R.GetHL();
-	m_R.Sub16Cy(&v, m_R.GetDE(), m_R.F.C);
-	m_R.SetHL(v);
-	return;
-}
-void CZ80MsxDos::op_LD_memAD_DE()
-{
-	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	m_pMemSys->Write(ad+0, m_R.E);
-	m_pMemSys->Write(ad+1, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_IM_1()
-{
-	m_IM = INTERRUPTMODE1;
-	return;
-}
-void CZ80MsxDos::op_LD_A_i()
-{
-	m_R.A = m_R.I;
-	//
-	m_R.F.C = m_R.F.C;
-	m_R.F.Z = (m_R.A==0)?1:0;
-	m_R.F.PV = (m_bIFF2)?1:0;
-	m_R.F.S = (m_R.A>>7)&0x01;
-	m_R.F.N = 0;
-	m_R.F.H = 0;
-	return;
-}
-void CZ80MsxDos::op_IN_E_memC()
-{
-	m_R.E = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.E);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_E()
-{
-	m_pIoSys->Out(m_R.C, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_ADC_HL_DE()
-{
-	uint16_t v = m_R.GetHL();
-	m_R.Add16Cy(&v, m_R.GetDE(), m_R.F.C);
-	m_R.SetHL(v);
-	return;
-}
-void CZ80MsxDos::op_LD_DE_memAD()
-{
-	z80memaddr_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	m_R.E = m_pMemSys->Read(ad+0);
-	m_R.D = m_pMemSys->Read(ad+1);
-	return;
-}
-void CZ80MsxDos::op_IM_2()
-{
-	m_IM = INTERRUPTMODE2;
-	return;
-}
-void CZ80MsxDos::op_LD_A_R()
-{
-	m_R.A = m_R.R;
-	//
-	m_R.F.C = m_R.F.C;
-	m_R.F.Z = (m_R.A==0)?1:0;
-	m_R.F.PV = (m_bIFF2)?1:0;
-	m_R.F.S = (m_R.A>>7)&0x01;
-	m_R.F.N = 0;
-	m_R.F.H = 0;
-	return;
-}
-void CZ80MsxDos::op_IN_H_memC()
-{
-	m_R.H = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.H);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_H()
-{
-	m_pIoSys->Out(m_R.C, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_SBC_HL_HL()
-{
-	uint16_t v = m_R.GetHL();
-	m_R.Sub16Cy(&v, v, m_R.F.C);
-	m_R.SetHL(v);
-	return;
-}
-void CZ80MsxDos::op_RRD()
+void CZ80MsxDos::op_RRD()
 {
 	uint8_t mem = m_pMemSys->Read(m_R.GetHL());
 	uint8_t temp = mem&0x0F;
@@ -6247,17 +4481,6 @@ void CZ80MsxDos::op_RRD()
 	m_R.F.H = 0;
 	return;
 }
-void CZ80MsxDos::op_IN_L_memC()
-{
-	m_R.L = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.L);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_L()
-{
-	m_pIoSys->Out(m_R.C, m_R.L);
-	return;
-}
 void CZ80MsxDos::op_ADC_HL_HL()
 {
 	uint16_t v = m_R.GetHL();
@@ -6299,17 +4522,6 @@ void CZ80MsxDos::op_LD_memAD_SP()
 	m_pMemSys->Write(ad+1, (m_R.SP>>8)&0xff);
 	return;
 }
-void CZ80MsxDos::op_IN_A_memC()
-{
-	m_R.A = m_pIoSys->In(m_R.C);
-	m_R.SetFlagByIN(m_R.A);
-	return;
-}
-void CZ80MsxDos::op_OUT_memC_A()
-{
-	m_pIoSys->Out(m_R.C, m_R.A);
-	return;
-}
 void CZ80MsxDos::op_ADC_HL_SP()
 {
 	uint16_t v = m_R.GetHL();
@@ -6445,17 +4657,14 @@ void CZ80MsxDos::op_OUTD()
 }
 void CZ80MsxDos::op_LDIR()
 {
-	uint16_t hl = m_R.GetHL();
-	uint16_t de = m_R.GetDE();
-	uint16_t bc = m_R.GetBC();
-	do{
-		uint8_t v = m_pMemSys->Read(hl);
-		m_pMemSys->Write(de, v);
-		++hl, ++de, --bc;
-	} while(bc != 0);
-	m_R.SetHL(hl);
-	m_R.SetDE(de);
-	m_R.SetBC(bc);
+	// BC=0 は 65536 回繰り返す
+	const uint16_t bc = m_R.GetBC();
+	const uint32_t rep = (bc == 0) ? 0x10000 : bc;		// 繰り返す回数
+	m_pMemSys->CopyBlock(m_R.GetDE(), m_R.GetHL(), rep);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
+	m_R.SetHL(static_cast<uint16_t>(m_R.GetHL() + rep));
+	m_R.SetDE(static_cast<uint16_t>(m_R.GetDE() + rep));
+	m_R.SetBC(0);
 	m_R.F.PV = 0;
 	m_R.F.N = 0;
 	m_R.F.H = 0;
@@ -6466,7 +4675,9 @@ void CZ80MsxDos::op_CPIR()
 	uint8_t a = m_R.A;
 	uint16_t hl = m_R.GetHL();
 	uint16_t bc = m_R.GetBC();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pMemSys->Read(hl);
 		++hl, --bc;
 		if(v == a ){
@@ -6477,9 +4688,11 @@ void CZ80MsxDos::op_CPIR()
 			m_R.F.S = 0;
 			m_R.F.N = 1;
 			m_R.F.H = 0;
+			m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 			return;
 		}
 	}while(bc!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	//
 	m_R.SetHL(hl);
 	m_R.SetBC(bc);
@@ -6492,11 +4705,14 @@ void CZ80MsxDos::op_CPIR()
 void CZ80MsxDos::op_INIR()
 {
 	uint16_t hl = m_R.GetHL();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pIoSys->In(m_R.C);
 		m_pMemSys->Write(hl, v);
 		++hl,m_R.B--;
 	}while(m_R.B!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	//
 	m_R.SetHL(hl);
 	m_R.F.Z = 1;
@@ -6506,11 +4722,14 @@ void CZ80MsxDos::op_INIR()
 void CZ80MsxDos::op_OTIR()
 {
 	uint16_t hl = m_R.GetHL();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pMemSys->Read(hl);
 		m_pIoSys->Out(m_R.C, v);
 		++hl, m_R.B--;
 	}while(m_R.B!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	m_R.SetHL(hl);
 	m_R.F.Z = 1;
 	m_R.F.N = 1;
@@ -6521,11 +4740,14 @@ void CZ80MsxDos::op_LDDR()
 	uint16_t hl = m_R.GetHL();
 	uint16_t de = m_R.GetDE();
 	uint16_t bc = m_R.GetBC();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pMemSys->Read(hl);
 		m_pMemSys->Write(de, v);
 		--hl, --de, --bc;
 	} while(bc != 0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	m_R.SetHL(hl);
 	m_R.SetDE(de);
 	m_R.SetBC(bc);
@@ -6539,7 +4761,9 @@ void CZ80MsxDos::op_CPDR()
 	uint8_t a = m_R.A;
 	uint16_t hl = m_R.GetHL();
 	uint16_t bc = m_R.GetBC();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pMemSys->Read(hl);
 		--hl, --bc;
 		if (v == a) {
@@ -6550,9 +4774,11 @@ void CZ80MsxDos::op_CPDR()
 			m_R.F.S = 0;
 			m_R.F.N = 1;
 			m_R.F.H = 0;
+			m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 			return;
 		}
 	}while(bc!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	//
 	m_R.SetHL(hl);
 	m_R.SetBC(bc);
@@ -6565,11 +4791,14 @@ void CZ80MsxDos::op_CPDR()
 void CZ80MsxDos::op_INDR()
 {
 	uint16_t hl = m_R.GetHL();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pIoSys->In(m_R.C);
 		m_pMemSys->Write(hl, v);
 		--hl,m_R.B--;
 	}while(m_R.B!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	//
 	m_R.SetHL(hl);
 	m_R.F.Z = 1;
@@ -6579,95 +4808,21 @@ void CZ80MsxDos::op_INDR()
 void CZ80MsxDos::op_OUTR()
 {
 	uint16_t hl = m_R.GetHL();
+	uint32_t rep = 0;		// 繰り返した回数
 	do{
+		++rep;
 		uint8_t v = m_pMemSys->Read(hl);
 		m_pIoSys->Out(m_R.C, v);
 		--hl, m_R.B--;
 	}while(m_R.B!=0);
+	m_Clock.AddTStates(Z80TS_BLOCK_REPEAT * (rep-1));
 	m_R.SetHL(hl);
-	m_R.F.Z = 1;
-	m_R.F.N = 1;
-	return;
-}
-
-// extended4 for IY
-void CZ80MsxDos::op_ADD_IY_BC()
-{
-	m_R.Add16(&m_R.IY, m_R.GetBC());
-	return;
-}
-void CZ80MsxDos::op_ADD_IY_DE()
-{
-	m_R.Add16(&m_R.IY, m_R.GetDE());
-	return;
-}
-void CZ80MsxDos::op_LD_IY_ad()
-{
-	m_R.IY = m_pMemSys->Read(m_R.PC++);
-	m_R.IY |= static_cast<uint16_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	return;
-}
-void CZ80MsxDos::op_LD_memAD_IY()
-{
-	uint16_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	//
-	m_pMemSys->Write(ad+0, (m_R.IY>>0)&0xff);
-	m_pMemSys->Write(ad+1, (m_R.IY>>8)&0xff);
-	return;
-}
-void CZ80MsxDos::op_INC_IY()
-{
-	++m_R.IY;
-	return;
-}
-void CZ80MsxDos::op_ADD_IY_IY()
-{
-	m_R.Add16(&m_R.IY, m_R.IY);
-	return;
-}
-void CZ80MsxDos::op_LD_IY_memAD()
-{
-	uint16_t ad = m_pMemSys->Read(m_R.PC++);
-	ad |= static_cast<z80memaddr_t>(m_pMemSys->Read(m_R.PC++)) << 8;
-	//
-	m_R.IY = m_pMemSys->Read(ad + 0);
-	m_R.IY |= static_cast<uint16_t>(m_pMemSys->Read(ad + 1)) << 8;
-	return;
-}
-void CZ80MsxDos::op_DEC_IY()
-{
-	--m_R.IY;
-	return;
-}
-void CZ80MsxDos::op_INC_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Inc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_DEC_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Dec8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_v()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_ADD_IY_SP()
-{
-	m_R.Add16(&m_R.IY, m_R.SP);
+	m_R.F.Z = 1;
+	m_R.F.N = 1;
 	return;
 }
+
+// extended4 for IY
 void CZ80MsxDos::op_LD_B_IYH()	// undoc.Z80
 {
 	m_R.B = (m_R.IY >> 8 ) & 0xFF;
@@ -6678,12 +4833,6 @@ void CZ80MsxDos::op_LD_B_IYL()	// undoc.Z80
 	m_R.B = m_R.IY & 0xFF;
 	return;
 }
-void CZ80MsxDos::op_LD_B_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.B = m_pMemSys->Read(ad);
-	return;
-}
 void CZ80MsxDos::op_LD_C_IYH()	// undoc.Z80
 {
 	m_R.C = (m_R.IY >> 8) & 0xFF;
@@ -6694,35 +4843,11 @@ void CZ80MsxDos::op_LD_C_IYL()	// undoc.Z80
 	m_R.C = m_R.IY & 0xFF;
 	return;
 }
-void CZ80MsxDos::op_LD_C_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.C = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_D_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.D = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_LD_E_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.E = m_pMemSys->Read(ad);
-	return;
-}
 void CZ80MsxDos::op_LD_IYH_E()	// undoc.Z80
 {
 	m_R.IY = (m_R.IY & 0xFF) | (static_cast<uint16_t>(m_R.E) << 8);
 	return;
 }
-void CZ80MsxDos::op_LD_H_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.H = m_pMemSys->Read(ad);
-	return;
-}
 void CZ80MsxDos::op_LD_IYL_IYH()	// undoc.Z80	// blueMSXの逆アセンブラだと LD_IYL,H と表示されるがそれは間違いっぽい
 {
 	m_R.IY = (m_R.IY & 0xFF00) | ((m_R.IY >> 8) & 0xFF);
@@ -6733,59 +4858,11 @@ void CZ80MsxDos::op_LD_IYL_IYL()	// undoc.Z80
 	// do nothing
 	return;
 }
-void CZ80MsxDos::op_LD_L_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.L = m_pMemSys->Read(ad);
-	return;
-}
 void CZ80MsxDos::op_LD_IYL_A()	// undoc.Z80
 {
 	m_R.IY = (m_R.IY & 0xFF00) | m_R.A;
 	return;
 }
-void CZ80MsxDos::op_LD_memIYpV_B()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.B);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_C()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.C);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_D()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.D);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_E()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.E);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_H()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.H);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_L()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.L);
-	return;
-}
-void CZ80MsxDos::op_LD_memIYpV_A()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_pMemSys->Write(ad, m_R.A);
-	return;
-}
 void CZ80MsxDos::op_LD_A_IYH()	// undoc.Z80
 {
 	m_R.A = static_cast<uint8_t>((m_R.IY>>8)&0xFF);
@@ -6796,69 +4873,6 @@ void CZ80MsxDos::op_LD_A_IYL()	// undoc.Z80
 	m_R.A = static_cast<uint8_t>(m_R.IY&0xFF);
 	return;
 }
-void CZ80MsxDos::op_LD_A_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	m_R.A = m_pMemSys->Read(ad);
-	return;
-}
-void CZ80MsxDos::op_ADD_A_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_ADC_A_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Add8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_SUB_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_SBC_A_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sub8Cy(&m_R.A, v, m_R.F.C);
-	return;
-}
-void CZ80MsxDos::op_AND_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.And8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_XOR_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Xor8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_OR_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Or8(&m_R.A, v);
-	return;
-}
-void CZ80MsxDos::op_CP_memIYpV()
-{
-	uint16_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	uint8_t tempA = m_R.A;
-	m_R.Sub8(&tempA, v);
-	return;
-}
 void CZ80MsxDos::op_EXTENDED_4IY2()
 {
 	// このマシンコードは、DDh+CBh+nn+vv の形式になっていて、
@@ -6866,17 +4880,12 @@ void CZ80MsxDos::op_EXTENDED_4IY2()
 	// このメソッドが呼ばれた時点で、DDh+CBhまではデコードされているからPCの位置はnnを示している。
 	// 子メソッドを呼び出す時はこの位置を維持する。子メソッドから戻ったら06hの分のPC++を行う。
 	uint8_t vv = m_pMemSys->Read(m_R.PC+1);
+	m_Clock.AddTStates(Z80TS_DDCB[vv]);
 	auto pFunc = OpCode_Extended4IY2[vv].pFunc;
 	(this->*pFunc)();
 	m_R.PC++;
 	return;
 }
-void CZ80MsxDos::op_POP_IY()
-{
-	m_R.IY = m_pMemSys->Read(m_R.SP++);
-	m_R.IY |= static_cast<uint16_t>(m_pMemSys->Read(m_R.SP++)) << 8;
-	return;
-}
 void CZ80MsxDos::op_EX_memSP_IY()
 {
 	uint8_t iyl = (m_R.IY >> 0) & 0xFF;
@@ -6887,271 +4896,7 @@ void CZ80MsxDos::op_EX_memSP_IY()
 	m_pMemSys->Write(m_R.SP+1, iyh);
 	return;
 }
-void CZ80MsxDos::op_PUSH_IY()
-{
-	m_pMemSys->Write(--m_R.SP, (m_R.IY>>8)&0xFF);
-	m_pMemSys->Write(--m_R.SP, (m_R.IY>>0)&0xFF);
-	return;
-}
-void CZ80MsxDos::op_JP_memIY()
-{
-	m_R.PC = m_R.IY;	// IYの値そのものがアドレス値である
-	return;
-}
-void CZ80MsxDos::op_LD_SP_IY()
-{
-	m_R.SP = m_R.IY;
-	return;
-}
 
 // extended4 for IY - 2
-void CZ80MsxDos::op_RLC_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rlc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RRC_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rrc8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RL_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rl8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RR_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Rr8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SLA_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sla8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SRA_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Sra8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SRL_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.Srl8(&v);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_BIT_0_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = (v & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_1_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>1) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_2_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>2) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_3_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>3) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_4_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>4) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_5_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>5) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_6_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>6) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_BIT_7_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	m_R.F.Z = ((v>>7) & 0x01) ^ 0x01;
-	m_R.F.N = 0, m_R.F.H = 1;
-	return;
-}
-void CZ80MsxDos::op_RES_0_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 0) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_1_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 1) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_2_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 2) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_3_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 3) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_4_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 4) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_5_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 5) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_6_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 6) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_RES_7_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v &= ((0x01 << 7) ^ 0xFF);
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_0_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 0;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_1_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 1;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_2_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 2;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_3_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 3;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_4_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 4;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_5_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 5;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_6_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 6;
-	m_pMemSys->Write(ad, v);
-	return;
-}
-void CZ80MsxDos::op_SET_7_memVpIY()
-{
-	z80memaddr_t ad = m_R.IY + m_pMemSys->Read(m_R.PC++);
-	uint8_t v = m_pMemSys->Read(ad);
-	v |= 0x01 << 7;
-	m_pMemSys->Write(ad, v);
-	return;
-}
 
 
@@ -2,11 +2,17 @@
 #pragma once
 #include"msxdef.h"
 #include"CZ80Regs.h"
-#include "CUTimeCount.h"
+#include "CMsxClock.h"
+#include "CFrameScheduler.h"
 #include <vector>
 
 class CMsxMemSlotSystem;
 class CMsxIoSystem;
+class CMsxMemoryMapper;
+class CLoopDetector;
+class CFrameProfiler;
+class CChipPipeline;
+class CZ80Trace;
 
 class CZ80MsxDos
 {
@@ -19,32 +25,54 @@ public:
 	{
 		int	Code;
 		POpCodeFunc pFunc;
-		Z80OPECODE_FUNC(int c, POpCodeFunc p) : Code(c), pFunc(p) { return; }
+		constexpr Z80OPECODE_FUNC(int c, POpCodeFunc p) : Code(c), pFunc(p) {}
 	};
+	/** テーブルの要素番号と命令コードが一致しているか（static_assert 用） */
+	static constexpr bool IsOrderedTable(const Z80OPECODE_FUNC (&table)[256], const int index = 0)
+	{
+		return index == 256 || (table[index].Code == index && IsOrderedTable(table, index + 1));
+	}
 
 public:
 	CZ80Regs			m_R;
 	CMsxMemSlotSystem	*m_pMemSys;
 	CMsxIoSystem		*m_pIoSys;
+	CMsxMemoryMapper	*m_pMapper;
 	bool				m_bHalt;
 	bool				m_bIFF1, m_bIFF2;
+	bool				m_bEiDelay;			// EI の直後（次の命令を実行するまで割り込みを受け付けない）
 	INTERRUPTMODE		m_IM;
-	CUTimeCount			m_Tim;
-	CUTimeCount			m_Tim16ms;
-	uint64_t			m_Tim16msOld;
-
-	std::vector<Z80OPECODE_FUNC> OpCode_Single;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended1;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended2IX;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended2IX2;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended4IY;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended4IY2;
-	std::vector<Z80OPECODE_FUNC> OpCode_Extended3;
-
-#ifndef NDEBUG
-	std::vector<CZ80Regs> m_PcHist;
-#endif
+	CMsxClock			m_Clock;			// Z80 から見た時刻
+	uint32_t			m_VsyncPeriod;		// VSYNC割り込みの周期[Tステート]（0=割り込まない）
+	uint64_t			m_NextVsync;		// 次のVSYNC割り込みの時刻[Tステート]
+	bool				m_bInVsync;			// H.TIMI の実行中
+	CZ80Regs			m_IntRegs;			// 割り込みを受け付けたときのレジスタ
+	static const int	NOT_BUSY_LOOP_NUM = 64;
+	uint32_t			m_NotBusyLoopPC[NOT_BUSY_LOOP_NUM];	// 待ちループではなかった分岐命令のアドレス（下位ビットで引く。調べ直さない）
+	CFrameScheduler		m_FrameSched;		// ST16MS/WT16MS のフレーム周期
+	// PLAYER.COM から教えてもらう MGSDRV の状態
+	z80memaddr_t		m_MgsWorkAddr;
+	bool				m_bMgsWorkValid;
+	bool				m_bMgsPlaying;
+	bool				m_bSongEnd;
+	uint8_t				m_MgsLoopCount;
+	int					m_MgsVolume;		// PLAYER.COM が MGS_PLYST を呼ぶ前に設定し直す音量（0～15）
+	uint32_t			m_FrameCount;
+	bool				m_bHeadless;		// true=WT16MSで待たない
+	CLoopDetector		*m_pLoopDetector;
+	CFrameProfiler		*m_pProfiler;
+	CChipPipeline		*m_pPipeline;		// 先読みする場合、WT16MS でフレームを区切る
+	uint64_t			m_InstCount;		// 実行した命令数
+	CZ80Trace			*m_pTrace;			// 命令ごとの実行記録（nullptr=記録しない）
 
+	// 命令のディスパッチテーブル（全インスタンスで共有する。中身は CZ80MsxDos.cpp で constexpr で定義）
+	static const Z80OPECODE_FUNC OpCode_Single[256];
+	static const Z80OPECODE_FUNC OpCode_Extended1[256];
+	static const Z80OPECODE_FUNC OpCode_Extended2IX[256];
+	static const Z80OPECODE_FUNC OpCode_Extended2IX2[256];
+	static const Z80OPECODE_FUNC OpCode_Extended4IY[256];
+	static const Z80OPECODE_FUNC OpCode_Extended4IY2[256];
+	static const Z80OPECODE_FUNC OpCode_Extended3[256];
 
 public:
 	CZ80MsxDos();
@@ -54,6 +82,7 @@ public:
 	void ResetCpu();
 	void ResetCpu(const z80memaddr_t pc, const z80memaddr_t sp);
 	void SetSubSystem(CMsxMemSlotSystem *pMemSlot, CMsxIoSystem *pIoObj);
+	void SetMemoryMapper(CMsxMemoryMapper *pMapper);
 	void Execution();
 
 	void OpCodeMachine();
@@ -67,64 +96,127 @@ public:
 	uint16_t Pop16();
 	z80memaddr_t GetPC() const;
 	z80memaddr_t GetSP() const;
+	void SetMgsLoopCount(const uint8_t cnt);
+	void SetMgsVolume(const int vol);
+	void CallMgsMasterVolume(const int vol);
+	bool IsSongEnd() const;
+	bool IsStalled() const;
+	uint32_t GetFrameCount() const;
+	uint64_t GetInstCount() const;
+	void SetHeadless(const bool bHeadless);
+	void SetLoopDetector(CLoopDetector *pDetector);
+	void SetProfiler(CFrameProfiler *pProfiler);
+	void SetChipPipeline(CChipPipeline *pPipeline);
+	void SetTrace(CZ80Trace *pTrace);
+	uint8_t GetMgsLoopCounter() const;
+	const CFrameScheduler::STATS &GetFrameStats() const;
+	void ResetFrameTiming();
+	void SetFramePeriod(const int64_t periodNs);
+	CMsxClock *GetClock();
+	void SetVsyncInterrupt(const uint32_t period);
+	void CallSubroutine(const z80memaddr_t addr);
 
 private:
-	void setup();
+	void beginFrame();
+	void endFrame();
+	void clearNotBusyLoop();
+	void checkIdleLoop();
+	void recordTrace();
+	uint64_t getTStatesToInterrupt() const;
+	bool skipBusyLoop();
 
 private:
 	std::vector<int> m_MemoryMapper;
-	bool patchingMapper(int *pPsegNo, int usersys);
+	std::vector<uint8_t> m_FreeSegments;	// 未割当のセグメント番号（末尾から割り当てる）
+	bool allocSegment(int *pSegNo, const int usersys);
+	bool freeSegment(const int segNo);
+	int getNumFreeSegments() const;
+	void callSegment(const int seg, const z80memaddr_t addr);
 
 private:
 	void op_UNDEFINED();
+	// レジスタ等をテンプレート引数にした命令群（実体は CZ80MsxDos.cpp）
+	typedef uint8_t CZ80Regs::*PREG8;
+	typedef uint16_t CZ80Regs::*PREG16;
+	typedef void (CZ80Regs::*PALU8)(uint8_t*, const uint8_t);
+	typedef void (CZ80Regs::*PALU8CY)(uint8_t*, const uint8_t, const uint8_t);
+	typedef void (CZ80Regs::*PSHIFT8)(uint8_t*);
+	template<PREG8 D, PREG8 S> void op_LD_r_r();
+	template<PREG8 D> void op_LD_r_v();
+	template<PREG8 D> void op_LD_r_memHL();
+	template<PREG8 S> void op_LD_memHL_r();
+	template<PREG8 R> void op_INC_r();
+	template<PREG8 R> void op_DEC_r();
+	template<PALU8 OP, PREG8 S> void op_ALU_r();
+	template<PALU8 OP> void op_ALU_memHL();
+	template<PALU8CY OP, PREG8 S> void op_ALUCY_r();
+	template<PALU8CY OP> void op_ALUCY_memHL();
+	template<PREG8 S> void op_CP_r();
+	template<PSHIFT8 OP, PREG8 R> void op_SHIFT_r();
+	template<PSHIFT8 OP> void op_SHIFT_memHL();
+	template<int N, PREG8 R> void op_BIT_n_r();
+	template<int N> void op_BIT_n_memHL();
+	template<int N, PREG8 R> void op_RES_n_r();
+	template<int N> void op_RES_n_memHL();
+	template<int N, PREG8 R> void op_SET_n_r();
+	template<int N> void op_SET_n_memHL();
+	template<PREG8 D> void op_IN_r_memC();
+	template<PREG8 S> void op_OUT_memC_r();
+	template<PREG16 I> void op_LD_I_ad();
+	template<PREG16 I> void op_LD_memAD_I();
+	template<PREG16 I> void op_LD_I_memAD();
+	template<PREG16 I> void op_INC_I();
+	template<PREG16 I> void op_DEC_I();
+	template<PREG16 I> void op_ADD_I_BC();
+	template<PREG16 I> void op_ADD_I_DE();
+	template<PREG16 I> void op_ADD_I_I();
+	template<PREG16 I> void op_ADD_I_SP();
+	template<PREG16 I> void op_POP_I();
+	template<PREG16 I> void op_PUSH_I();
+	template<PREG16 I> void op_JP_memI();
+	template<PREG16 I> void op_LD_SP_I();
+	template<PREG8 D, PREG16 I> void op_LD_r_memIpV();
+	template<PREG8 S, PREG16 I> void op_LD_memIpV_r();
+	template<PREG16 I> void op_LD_memIpV_v();
+	template<PREG16 I> void op_INC_memIpV();
+	template<PREG16 I> void op_DEC_memIpV();
+	template<PALU8 OP, PREG16 I> void op_ALU_memIpV();
+	template<PALU8CY OP, PREG16 I> void op_ALUCY_memIpV();
+	template<PREG16 I> void op_CP_memIpV();
+	template<PSHIFT8 OP, PREG16 I> void op_SHIFT_memVpI();
+	template<int N, PREG16 I> void op_BIT_n_memVpI();
+	template<int N, PREG16 I> void op_RES_n_memVpI();
+	template<int N, PREG16 I> void op_SET_n_memVpI();
 	// single-byte opecode
 	void op_NOP();
 	void op_LD_BC_ad();
 	void op_LD_memBC_A();
 	void op_INC_BC();
-	void op_INC_B();
-	void op_DEC_B();
-	void op_LD_B_v();
 	void op_RLCA();
 	void op_EX_AF_AF();
 	void op_ADD_HL_BC();
 	void op_LD_A_memBC();
 	void op_DEC_BC();
-	void op_INC_C();
-	void op_DEC_C();
-	void op_LD_C_v();
 	void op_RRCA();
 	void op_DJNZ_v();
 	void op_LD_DE_ad();
 	void op_LD_memDE_A();
 	void op_INC_DE();
-	void op_INC_D();
-	void op_DEC_D();
-	void op_LD_D_v();
 	void op_RLA();
 	void op_JR_v();
 	void op_ADD_HL_DE();
 	void op_LD_A_memDE();
 	void op_DEC_DE();
-	void op_INC_E();
-	void op_DEC_E();
-	void op_LD_E_v();
 	void op_RRA();
 	void op_JR_nz_v();
 	void op_LD_HL_ad();
 	void op_LD_memAD_HL();
 	void op_INC_HL();
-	void op_INC_H();
-	void op_DEC_H();
-	void op_LD_H_v();
 	void op_DAA();
 	void op_JR_z_v();
 	void op_ADD_HL_HL();
 	void op_LD_HL_memAD();
 	void op_DEC_HL();
-	void op_INC_L();
-	void op_DEC_L();
-	void op_LD_L_v();
 	void op_CPL();
 	void op_JR_nc_v();
 	void op_LD_SP_ad();
@@ -138,138 +230,9 @@ private:
 	void op_ADD_HL_SP();
 	void op_LD_A_memAD();
 	void op_DEC_SP();
-	void op_INC_A();
-	void op_DEC_A();
-	void op_LD_A_v();
 	void op_CCF();
-	void op_LD_B_B();
-	void op_LD_B_C();
-	void op_LD_B_D();
-	void op_LD_B_E();
-	void op_LD_B_H();
-	void op_LD_B_L();
-	void op_LD_B_memHL();
-	void op_LD_B_A();
-	void op_LD_C_B();
-	void op_LD_C_C();
-	void op_LD_C_D();
-	void op_LD_C_E();
-	void op_LD_C_H();
-	void op_LD_C_L();
-	void op_LD_C_memHL();
-	void op_LD_C_A();
-	void op_LD_D_B();
-	void op_LD_D_C();
-	void op_LD_D_D();
-	void op_LD_D_E();
-	void op_LD_D_H();
-	void op_LD_D_L();
-	void op_LD_D_memHL();
-	void op_LD_D_A();
-	void op_LD_E_B();
-	void op_LD_E_C();
-	void op_LD_E_D();
-	void op_LD_E_E();
-	void op_LD_E_H();
-	void op_LD_E_L();
-	void op_LD_E_memHL();
-	void op_LD_E_A();
-	void op_LD_H_B();
-	void op_LD_H_C();
-	void op_LD_H_D();
-	void op_LD_H_E();
-	void op_LD_H_H();
-	void op_LD_H_L();
-	void op_LD_H_memHL();
-	void op_LD_H_A();
-	void op_LD_L_B();
-	void op_LD_L_C();
-	void op_LD_L_D();
-	void op_LD_L_E();
-	void op_LD_L_H();
-	void op_LD_L_L();
-	void op_LD_L_memHL();
-	void op_LD_L_A();
-	void op_LD_memHL_B();
-	void op_LD_memHL_C();
-	void op_LD_memHL_D();
-	void op_LD_memHL_E();
-	void op_LD_memHL_H();
-	void op_LD_memHL_L();
 	void op_HALT();
-	void op_LD_memHL_A();
-	void op_LD_A_B();
-	void op_LD_A_C();
-	void op_LD_A_D();
-	void op_LD_A_E();
-	void op_LD_A_H();
-	void op_LD_A_L();
-	void op_LD_A_memHL();
-	void op_LD_A_A();
-	void op_ADD_A_B();
-	void op_ADD_A_C();
-	void op_ADD_A_D();
-	void op_ADD_A_E();
-	void op_ADD_A_H();
-	void op_ADD_A_L();
-	void op_ADD_A_memHL();
-	void op_ADD_A_A();
-	void op_ADC_A_B();
-	void op_ADC_A_C();
-	void op_ADC_A_D();
-	void op_ADC_A_E();
-	void op_ADC_A_H();
-	void op_ADC_A_L();
-	void op_ADC_A_memHL();
-	void op_ADC_A_A();
-	void op_SUB_B();
-	void op_SUB_C();
-	void op_SUB_D();
-	void op_SUB_E();
-	void op_SUB_H();
-	void op_SUB_L();
-	void op_SUB_memHL();
-	void op_SUB_A();
-	void op_SBC_A_B();
-	void op_SBC_A_C();
-	void op_SBC_A_D();
-	void op_SBC_A_E();
-	void op_SBC_A_H();
-	void op_SBC_A_L();
-	void op_SBC_A_memHL();
-	void op_SBC_A();
-	void op_AND_B();
-	void op_AND_C();
-	void op_AND_D();
-	void op_AND_E();
-	void op_AND_H();
-	void op_AND_L();
-	void op_AND_memHL();
-	void op_AND_A();
-	void op_XOR_B();
-	void op_XOR_C();
-	void op_XOR_D();
-	void op_XOR_E();
-	void op_XOR_H();
-	void op_XOR_L();
-	void op_XOR_memHL();
-	void op_XOR_A();
-	void op_OR_B();
-	void op_OR_C();
-	void op_OR_D();
-	void op_OR_E();
-	void op_OR_H();
-	void op_OR_L();
-	void op_OR_memHL();
-	void op_OR_A();
-	void op_CP_B();
-	void op_CP_C();
-	void op_CP_D();
-	void op_CP_E();
-	void op_CP_H();
-	void op_CP_L();
 	void op_CP_memHL();
-	void op_CP_A();
 	void op_RET_nz();
 	void op_POP_BC();
 	void op_JP_nz_ad();
@@ -334,378 +297,37 @@ private:
 	void op_EXTENDED_4IY();
 	void op_CP_v();
 	void op_RST_38h();
-	// extended1
-	void op_RLC_B();
-	void op_RLC_C();
-	void op_RLC_D();
-	void op_RLC_E();
-	void op_RLC_H();
-	void op_RLC_L();
-	void op_RLC_memHL();
-	void op_RLC_A();
-	void op_RRC_B();
-	void op_RRC_C();
-	void op_RRC_D();
-	void op_RRC_E();
-	void op_RRC_H();
-	void op_RRC_L();
-	void op_RRC_memHL();
-	void op_RRC_A();
-	void op_RL_B();
-	void op_RL_C();
-	void op_RL_D();
-	void op_RL_E();
-	void op_RL_H();
-	void op_RL_L();
-	void op_RL_memHL();
-	void op_RL_A();
-	void op_RR_B();
-	void op_RR_C();
-	void op_RR_D();
-	void op_RR_E();
-	void op_RR_H();
-	void op_RR_L();
-	void op_RR_memHL();
-	void op_RR_A();
-	void op_SLA_B();
-	void op_SLA_C();
-	void op_SLA_D();
-	void op_SLA_E();
-	void op_SLA_H();
-	void op_SLA_L();
-	void op_SLA_memHL();
-	void op_SLA_A();
-	void op_SRA_B();
-	void op_SRA_C();
-	void op_SRA_D();
-	void op_SRA_E();
-	void op_SRA_H();
-	void op_SRA_L();
-	void op_SRA_memHL();
-	void op_SRA_A();
-	void op_SLL_B();
-	void op_SLL_C();
-	void op_SLL_D();
-	void op_SLL_E();
-	void op_SLL_H();
-	void op_SLL_L();
-	void op_SLL_memHL();
-	void op_SLL_A();
-	void op_SRL_B();
-	void op_SRL_C();
-	void op_SRL_D();
-	void op_SRL_E();
-	void op_SRL_H();
-	void op_SRL_L();
-	void op_SRL_memHL();
-	void op_SRL_A();
-	void op_BIT_0_B();
-	void op_BIT_0_C();
-	void op_BIT_0_D();
-	void op_BIT_0_E();
-	void op_BIT_0_H();
-	void op_BIT_0_L();
-	void op_BIT_0_memHL();
-	void op_BIT_0_A();
-	void op_BIT_1_B();
-	void op_BIT_1_C();
-	void op_BIT_1_D();
-	void op_BIT_1_E();
-	void op_BIT_1_H();
-	void op_BIT_1_L();
-	void op_BIT_1_memHL();
-	void op_BIT_1_A();
-	void op_BIT_2_B();
-	void op_BIT_2_C();
-	void op_BIT_2_D();
-	void op_BIT_2_E();
-	void op_BIT_2_H();
-	void op_BIT_2_L();
-	void op_BIT_2_memHL();
-	void op_BIT_2_A();
-	void op_BIT_3_B();
-	void op_BIT_3_C();
-	void op_BIT_3_D();
-	void op_BIT_3_E();
-	void op_BIT_3_H();
-	void op_BIT_3_L();
-	void op_BIT_3_memHL();
-	void op_BIT_3_A();
-	void op_BIT_4_B();
-	void op_BIT_4_C();
-	void op_BIT_4_D();
-	void op_BIT_4_E();
-	void op_BIT_4_H();
-	void op_BIT_4_L();
-	void op_BIT_4_memHL();
-	void op_BIT_4_A();
-	void op_BIT_5_B();
-	void op_BIT_5_C();
-	void op_BIT_5_D();
-	void op_BIT_5_E();
-	void op_BIT_5_H();
-	void op_BIT_5_L();
-	void op_BIT_5_memHL();
-	void op_BIT_5_A();
-	void op_BIT_6_B();
-	void op_BIT_6_C();
-	void op_BIT_6_D();
-	void op_BIT_6_E();
-	void op_BIT_6_H();
-	void op_BIT_6_L();
-	void op_BIT_6_memHL();
-	void op_BIT_6_A();
-	void op_BIT_7_B();
-	void op_BIT_7_C();
-	void op_BIT_7_D();
-	void op_BIT_7_E();
-	void op_BIT_7_H();
-	void op_BIT_7_L();
-	void op_BIT_7_memHL();
-	void op_BIT_7_A();
-	void op_RES_0_B();
-	void op_RES_0_C();
-	void op_RES_0_D();
-	void op_RES_0_E();
-	void op_RES_0_H();
-	void op_RES_0_L();
-	void op_RES_0_memHL();
-	void op_RES_0_A();
-	void op_RES_1_B();
-	void op_RES_1_C();
-	void op_RES_1_D();
-	void op_RES_1_E();
-	void op_RES_1_H();
-	void op_RES_1_L();
-	void op_RES_1_memHL();
-	void op_RES_1_A();
-	void op_RES_2_B();
-	void op_RES_2_C();
-	void op_RES_2_D();
-	void op_RES_2_E();
-	void op_RES_2_H();
-	void op_RES_2_L();
-	void op_RES_2_memHL();
-	void op_RES_2_A();
-	void op_RES_3_B();
-	void op_RES_3_C();
-	void op_RES_3_D();
-	void op_RES_3_E();
-	void op_RES_3_H();
-	void op_RES_3_L();
-	void op_RES_3_memHL();
-	void op_RES_3_A();
-	void op_RES_4_B();
-	void op_RES_4_C();
-	void op_RES_4_D();
-	void op_RES_4_E();
-	void op_RES_4_H();
-	void op_RES_4_L();
-	void op_RES_4_memHL();
-	void op_RES_4_A();
-	void op_RES_5_B();
-	void op_RES_5_C();
-	void op_RES_5_D();
-	void op_RES_5_E();
-	void op_RES_5_H();
-	void op_RES_5_L();
-	void op_RES_5_memHL();
-	void op_RES_5_A();
-	void op_RES_6_B();
-	void op_RES_6_C();
-	void op_RES_6_D();
-	void op_RES_6_E();
-	void op_RES_6_H();
-	void op_RES_6_L();
-	void op_RES_6_memHL();
-	void op_RES_6_A();
-	void op_RES_7_B();
-	void op_RES_7_C();
-	void op_RES_7_D();
-	void op_RES_7_E();
-	void op_RES_7_H();
-	void op_RES_7_L();
-	void op_RES_7_memHL();
-	void op_RES_7_A();
-	void op_SET_0_B();
-	void op_SET_0_C();
-	void op_SET_0_D();
-	void op_SET_0_E();
-	void op_SET_0_H();
-	void op_SET_0_L();
-	void op_SET_0_memHL();
-	void op_SET_0_A();
-	void op_SET_1_B();
-	void op_SET_1_C();
-	void op_SET_1_D();
-	void op_SET_1_E();
-	void op_SET_1_H();
-	void op_SET_1_L();
-	void op_SET_1_memHL();
-	void op_SET_1_A();
-	void op_SET_2_B();
-	void op_SET_2_C();
-	void op_SET_2_D();
-	void op_SET_2_E();
-	void op_SET_2_H();
-	void op_SET_2_L();
-	void op_SET_2_memHL();
-	void op_SET_2_A();
-	void op_SET_3_B();
-	void op_SET_3_C();
-	void op_SET_3_D();
-	void op_SET_3_E();
-	void op_SET_3_H();
-	void op_SET_3_L();
-	void op_SET_3_memHL();
-	void op_SET_3_A();
-	void op_SET_4_B();
-	void op_SET_4_C();
-	void op_SET_4_D();
-	void op_SET_4_E();
-	void op_SET_4_H();
-	void op_SET_4_L();
-	void op_SET_4_memHL();
-	void op_SET_4_A();
-	void op_SET_5_B();
-	void op_SET_5_C();
-	void op_SET_5_D();
-	void op_SET_5_E();
-	void op_SET_5_H();
-	void op_SET_5_L();
-	void op_SET_5_memHL();
-	void op_SET_5_A();
-	void op_SET_6_B();
-	void op_SET_6_C();
-	void op_SET_6_D();
-	void op_SET_6_E();
-	void op_SET_6_H();
-	void op_SET_6_L();
-	void op_SET_6_memHL();
-	void op_SET_6_A();
-	void op_SET_7_B();
-	void op_SET_7_C();
-	void op_SET_7_D();
-	void op_SET_7_E();
-	void op_SET_7_H();
-	void op_SET_7_L();
-	void op_SET_7_memHL();
-	void op_SET_7_A();
 	// extended2 for IX
-	void op_ADD_IX_BC();
-	void op_ADD_IX_DE();
-	void op_LD_IX_ad();
-	void op_LD_memAD_IX();
-	void op_INC_IX();
-	void op_ADD_IX_IX();
-	void op_LD_IX_memAD();
-	void op_DEC_IX();
-	void op_INC_memIXpV();
-	void op_DEC_memIXpV();
-	void op_LD_memIXpV_v();
-	void op_ADD_IX_SP();
-	void op_LD_B_memIXpV();
-	void op_LD_C_memIXpV();
-	void op_LD_D_memIXpV();
-	void op_LD_E_memIXpV();
-	void op_LD_H_memIXpV();
-	void op_LD_L_memIXpV();
-	void op_LD_memIXpV_B();
-	void op_LD_memIXpV_C();
-	void op_LD_memIXpV_D();
-	void op_LD_memIXpV_E();
-	void op_LD_memIXpV_H();
-	void op_LD_memIXpV_L();
-	void op_LD_memIXpV_A();
-	void op_LD_A_memIXpV();
-	void op_ADD_A_memIXpV();
-	void op_ADC_A_memIXpV();
-	void op_SUB_memIXpV();
-	void op_SBC_A_memIXpV();
-	void op_AND_memIXpV();
-	void op_XOR_memIXpV();
-	void op_OR_memIXpV();
-	void op_CP_memIXpV();
 	void op_EXTENDED_2IX2();
-	void op_POP_IX();
 	void op_EX_memSP_IX();
-	void op_PUSH_IX();
-	void op_JP_memIX();
-	void op_LD_SP_IX();
-	// extended2 for IX - 2
-	void op_RLC_memVpIX();
-	void op_RRC_memVpIX();
-	void op_RL_memVpIX();
-	void op_RR_memVpIX();
-	void op_SLA_memVpIX();
-	void op_SRA_memVpIX();
-	void op_SRL_memVpIX();
-	void op_BIT_0_memVpIX();
-	void op_BIT_1_memVpIX();
-	void op_BIT_2_memVpIX();
-	void op_BIT_3_memVpIX();
-	void op_BIT_4_memVpIX();
-	void op_BIT_5_memVpIX();
-	void op_BIT_6_memVpIX();
-	void op_BIT_7_memVpIX();
-	void op_RES_0_memVpIX();
-	void op_RES_1_memVpIX();
-	void op_RES_2_memVpIX();
-	void op_RES_3_memVpIX();
-	void op_RES_4_memVpIX();
-	void op_RES_5_memVpIX();
-	void op_RES_6_memVpIX();
-	void op_RES_7_memVpIX();
-	void op_SET_0_memVpIX();
-	void op_SET_1_memVpIX();
-	void op_SET_2_memVpIX();
-	void op_SET_3_memVpIX();
-	void op_SET_4_memVpIX();
-	void op_SET_5_memVpIX();
-	void op_SET_6_memVpIX();
-	void op_SET_7_memVpIX();
 	// extended3 - for debug
 	void op_DEBUGBREAK();
 	// extended3
-	void op_IN_B_memC();
-	void op_OUT_memC_B();
 	void op_SBC_HL_BC();
 	void op_LD_memAD_BC();
 	void op_NEG();
 	void op_RETN();
 	void op_IM_0();
 	void op_LD_i_A();
-	void op_IN_C_memC();
-	void op_OUT_memC_C();
 	void op_ADC_HL_BC();
 	void op_LD_BC_memAD();
 	void op_RETI();
 	void op_LD_R_A();
-	void op_IN_D_memC();
-	void op_OUT_memC_D();
 	void op_SBC_HL_DE();
 	void op_LD_memAD_DE();
 	void op_IM_1();
 	void op_LD_A_i();
-	void op_IN_E_memC();
-	void op_OUT_memC_E();
 	void op_ADC_HL_DE();
 	void op_LD_DE_memAD();
 	void op_IM_2();
 	void op_LD_A_R();
-	void op_IN_H_memC();
-	void op_OUT_memC_H();
 	void op_SBC_HL_HL();
 	void op_RRD();
-	void op_IN_L_memC();
-	void op_OUT_memC_L();
 	void op_ADC_HL_HL();
 	void op_RLD();
 //	void op_IN_memC();
 	void op_SBC_HL_SP();
 	void op_LD_memAD_SP();
-	void op_IN_A_memC();
-	void op_OUT_memC_A();
 	void op_ADC_HL_SP();
 	void op_LD_SP_memAD();
 	void op_LDI();
@@ -725,88 +347,18 @@ private:
 	void op_INDR();
 	void op_OUTR();
 	// extended4 for IY
-	void op_ADD_IY_BC();
-	void op_ADD_IY_DE();
-	void op_LD_IY_ad();
-	void op_LD_memAD_IY();
-	void op_INC_IY();
-	void op_ADD_IY_IY();
-	void op_LD_IY_memAD();
-	void op_DEC_IY();
-	void op_INC_memIYpV();
-	void op_DEC_memIYpV();
-	void op_LD_memIYpV_v();
-	void op_ADD_IY_SP();
 	void op_LD_B_IYH();				// undoc.Z80	
 	void op_LD_B_IYL();				// undoc.Z80	
-	void op_LD_B_memIYpV();
 	void op_LD_C_IYH();				// undoc.Z80
 	void op_LD_C_IYL();				// undoc.Z80
-	void op_LD_C_memIYpV();
-	void op_LD_D_memIYpV();
-	void op_LD_E_memIYpV();
 	void op_LD_IYH_E();				// undoc.Z80
-	void op_LD_H_memIYpV();
 	void op_LD_IYL_IYH();			// undoc.Z80
 	void op_LD_IYL_IYL();			// undoc.Z80
-	void op_LD_L_memIYpV();
 	void op_LD_IYL_A();				// undoc.Z80
-	void op_LD_memIYpV_B();
-	void op_LD_memIYpV_C();
-	void op_LD_memIYpV_D();
-	void op_LD_memIYpV_E();
-	void op_LD_memIYpV_H();
-	void op_LD_memIYpV_L();
-	void op_LD_memIYpV_A();
 	void op_LD_A_IYH();				// undoc.Z80
 	void op_LD_A_IYL();				// undoc.Z80
-	void op_LD_A_memIYpV();
-	void op_ADD_A_memIYpV();
-	void op_ADC_A_memIYpV();
-	void op_SUB_memIYpV();
-	void op_SBC_A_memIYpV();
-	void op_AND_memIYpV();
-	void op_XOR_memIYpV();
-	void op_OR_memIYpV();
-	void op_CP_memIYpV();
 	void op_EXTENDED_4IY2();
-	void op_POP_IY();
 	void op_EX_memSP_IY();
-	void op_PUSH_IY();
-	void op_JP_memIY();
-	void op_LD_SP_IY();
-	// extended4 for IY - 2
-	void op_RLC_memVpIY();
-	void op_RRC_memVpIY();
-	void op_RL_memVpIY();
-	void op_RR_memVpIY();
-	void op_SLA_memVpIY();
-	void op_SRA_memVpIY();
-	void op_SRL_memVpIY();
-	void op_BIT_0_memVpIY();
-	void op_BIT_1_memVpIY();
-	void op_BIT_2_memVpIY();
-	void op_BIT_3_memVpIY();
-	void op_BIT_4_memVpIY();
-	void op_BIT_5_memVpIY();
-	void op_BIT_6_memVpIY();
-	void op_BIT_7_memVpIY();
-	void op_RES_0_memVpIY();
-	void op_RES_1_memVpIY();
-	void op_RES_2_memVpIY();
-	void op_RES_3_memVpIY();
-	void op_RES_4_memVpIY();
-	void op_RES_5_memVpIY();
-	void op_RES_6_memVpIY();
-	void op_RES_7_memVpIY();
-	void op_SET_0_memVpIY();
-	void op_SET_1_memVpIY();
-	void op_SET_2_memVpIY();
-	void op_SET_3_memVpIY();
-	void op_SET_4_memVpIY();
-	void op_SET_5_memVpIY();
-	void op_SET_6_memVpIY();
-	void op_SET_7_memVpIY();
 };
 
 
@@ -45,12 +45,32 @@ public:
 	}
 };
 
+// Z80_UNION_REGS を定義すると、BC/DE/HL（裏レジスタも）を 16bit でも 8bit でも読み書きできる共用体で持つ。
+// ペアの読み書きがシフトと合成ではなく１回の読み書きになり、EXX はペア単位の入れ替えになる。
+#if defined(Z80_UNION_REGS)
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define Z80_REGPAIR(hi, lo, pair)	union { struct { uint8_t hi, lo; }; uint16_t pair; }
+#else
+#define Z80_REGPAIR(hi, lo, pair)	union { struct { uint8_t lo, hi; }; uint16_t pair; }
+#endif
+#endif
+
 class CZ80Regs
 {
 public:
 	uint16_t PC;
+#if defined(Z80_UNION_REGS)
+	uint8_t A, I, R, Ad;
+	Z80_REGPAIR(B, C, BC);
+	Z80_REGPAIR(D, E, DE);
+	Z80_REGPAIR(H, L, HL);
+	Z80_REGPAIR(Bd, Cd, BCd);
+	Z80_REGPAIR(Dd, Ed, DEd);
+	Z80_REGPAIR(Hd, Ld, HLd);
+#else
 	uint8_t A,B,C,D,E,H,L,I,R;
 	uint8_t Ad,Bd,Cd,Dd,Ed,Hd,Ld;
+#endif
 	uint16_t IX, IY, SP;
 	CZ80FlagReg F, Fd;
 	uint16_t CodePC;
@@ -81,13 +101,22 @@ public:
 
 	inline uint16_t HILO(uint8_t hi, uint8_t lo) { return (hi<<8)|lo; }
 	inline uint16_t GetAF() { return HILO(A,F.Get()); }
+	inline void SetAF(const uint16_t AF) { A = (AF>>8)&0xff, F.Set(AF&0xff); }
+#if defined(Z80_UNION_REGS)
+	inline uint16_t GetBC() { return BC; }
+	inline uint16_t GetDE() { return DE; }
+	inline uint16_t GetHL() { return HL; }
+	inline void SetBC(const uint16_t v) { BC = v; }
+	inline void SetDE(const uint16_t v) { DE = v; }
+	inline void SetHL(const uint16_t v) { HL = v; }
+#else
 	inline uint16_t GetBC() { return HILO(B,C); }
 	inline uint16_t GetDE() { return HILO(D,E); }
 	inline uint16_t GetHL() { return HILO(H,L); }
-	inline void SetAF(const uint16_t AF) { A = (AF>>8)&0xff, F.Set(AF&0xff); }
 	inline void SetBC(const uint16_t BC) { B = (BC>>8)&0xff, C = BC&0xff; }
 	inline void SetDE(const uint16_t DE) { D = (DE>>8)&0xff, E = DE&0xff; }
 	inline void SetHL(const uint16_t HL) { H = (HL>>8)&0xff, L = HL&0xff; }
+#endif
 	inline void Swap(uint8_t *pR1, uint8_t *pR2)
 	{
 		uint8_t temp = *pR1;
@@ -95,6 +124,13 @@ public:
 		*pR2 = temp;
 		return;
 	}
+	inline void Swap(uint16_t *pR1, uint16_t *pR2)
+	{
+		uint16_t temp = *pR1;
+		*pR1 = *pR2;
+		*pR2 = temp;
+		return;
+	}
 	inline void Swap(CZ80FlagReg *pR1, CZ80FlagReg *pR2)
 	{
 		CZ80FlagReg temp = *pR1;
@@ -424,12 +460,18 @@ public:
 	// B,C,D,E,H,L レジスタ：裏レジスタを入れ替える
 	void Exchange()
 	{
+#if defined(Z80_UNION_REGS)
+		Swap(&BC, &BCd);
+		Swap(&DE, &DEd);
+		Swap(&HL, &HLd);
+#else
 		Swap(&B, &Bd);
 		Swap(&C, &Cd);
 		Swap(&D, &Dd);
 		Swap(&E, &Ed);
 		Swap(&H, &Hd);
 		Swap(&L, &Ld);
+#endif
 		return;
 	}
 };
\ No newline at end of file
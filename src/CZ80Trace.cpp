@@ -0,0 +1,64 @@
+﻿#include "stdafx.h"
+#include "CZ80Trace.h"
+#include <algorithm>
+#ifdef __linux
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @param numRecords 記録する命令数（2のべき乗に切り上げる）
+ */
+CZ80Trace::CZ80Trace(const size_t numRecords) : m_Seq(0)
+{
+	size_t num = 1;
+	while( num < numRecords )
+		num *= 2;
+	m_pRecords = GCC_NEW Z80TRACERECORD[num];
+	memset(m_pRecords, 0, sizeof(Z80TRACERECORD) * num);
+	m_Mask = num - 1;
+	return;
+}
+
+CZ80Trace::~CZ80Trace()
+{
+	NULL_DELETEARRAY(m_pRecords);
+	return;
+}
+
+/** 記録をファイルに書き出す
+ * Linux ではシグナルハンドラから呼べるよう、メモリを確保せず write() だけで書く。
+ */
+bool CZ80Trace::Dump(const char *pPath) const
+{
+	const size_t seq = m_Seq.load(std::memory_order_acquire);
+	const size_t num = (seq < m_Mask + 1) ? seq : m_Mask + 1;
+	const size_t first = seq - num;
+	Z80TRACEHEADER h;
+	memcpy(h.Magic, "HSZTRACE", sizeof(h.Magic));
+	h.Version = VERSION;
+	h.RecordSize = sizeof(Z80TRACERECORD);
+	h.NumRecords = static_cast<uint32_t>(num);
+	h.Reserved = 0;
+	h.FirstSeq = first;
+	// リングの折り返しで２つに分けて書く
+	const size_t top = first & m_Mask;
+	const size_t n1 = std::min(num, m_Mask + 1 - top);
+#ifdef __linux
+	const int fd = ::open(pPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if( fd < 0 )
+		return false;
+	bool bRet =
+		::write(fd, &h, sizeof(h)) == static_cast<ssize_t>(sizeof(h)) &&
+		::write(fd, &m_pRecords[top], sizeof(Z80TRACERECORD) * n1) == static_cast<ssize_t>(sizeof(Z80TRACERECORD) * n1) &&
+		::write(fd, &m_pRecords[0], sizeof(Z80TRACERECORD) * (num - n1)) == static_cast<ssize_t>(sizeof(Z80TRACERECORD) * (num - n1));
+	::close(fd);
+	return bRet;
+#else
+	std::ofstream ofs(pPath, std::ios::binary);
+	ofs.write(reinterpret_cast<const char*>(&h), sizeof(h));
+	ofs.write(reinterpret_cast<const char*>(&m_pRecords[top]), sizeof(Z80TRACERECORD) * n1);
+	ofs.write(reinterpret_cast<const char*>(&m_pRecords[0]), sizeof(Z80TRACERECORD) * (num - n1));
+	return ofs.good();
+#endif
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+#include <stddef.h>
+
+/** トレースファイルの先頭
+ */
+struct Z80TRACEHEADER
+{
+	char		Magic[8];		// "HSZTRACE"
+	uint32_t	Version;
+	uint32_t	RecordSize;		// sizeof(Z80TRACERECORD)
+	uint32_t	NumRecords;		// 続く記録の数
+	uint32_t	Reserved;
+	uint64_t	FirstSeq;		// 最初の記録の通し番号
+};
+static_assert(sizeof(Z80TRACEHEADER) == 32, "Z80TRACEHEADER must be 32 bytes");
+
+/** １命令分の記録（命令を実行する直前の状態）
+ */
+struct Z80TRACERECORD
+{
+	uint64_t	TStates;		// Z80 から見た時刻
+	uint32_t	InstNo;			// 実行した命令数（下位32bit）
+	uint16_t	PC, SP, AF, BC, DE, HL, IX, IY;
+	uint8_t		Code[4];		// PC から４バイト
+};
+static_assert(sizeof(Z80TRACERECORD) == 32, "Z80TRACERECORD must be 32 bytes");
+
+/** 命令ごとの実行記録（トレース）のリングバッファ
+ * 実行スレッドだけが書き込み、古い記録から上書きする。書き込み側は待たない（ロックフリー）。
+ * Dump() は別スレッドやシグナルハンドラから呼んでよい（書き込み中の記録が１つ混じることはある）。
+ * ファイルは Z80TRACEHEADER に続けて古い順に Z80TRACERECORD を並べたもの（ホストのバイト順）。
+ * 読み出しと逆アセンブルは hsztrace で行う。
+ */
+class CZ80Trace
+{
+public:
+	static const uint32_t VERSION = 1;
+
+private:
+	Z80TRACERECORD		*m_pRecords;
+	size_t				m_Mask;
+	std::atomic<size_t>	m_Seq;		// 次に書き込む記録の通し番号
+
+public:
+	explicit CZ80Trace(const size_t numRecords);
+	virtual ~CZ80Trace();
+
+public:
+	void Record(const Z80TRACERECORD &r)
+	{
+		const size_t seq = m_Seq.load(std::memory_order_relaxed);
+		m_pRecords[seq & m_Mask] = r;
+		m_Seq.store(seq + 1, std::memory_order_release);
+		return;
+	}
+	bool Dump(const char *pPath) const;
+};
@@ -2,9 +2,19 @@
 #include "tools.h"
 #include "msxdef.h"
 #include "CHopStepZ.h"
+#include "CPlayList.h"
+#include "CControlServer.h"
+#include "CIndexer.h"
+#include "CRealtime.h"
+#include "CChipPipeline.h"
+#include "CZ80Trace.h"
 #include "playercom.h"
+#include <atomic>
 
-static bool g_bRequestStop = false;
+static std::atomic<bool> g_bRequestStop(false);
+static std::atomic<bool> g_bRequestProfile(false);
+static CZ80Trace *g_pTrace = nullptr;	// --trace で指定した実行記録
+static std::string g_TracePath;
 #ifdef __linux
 #include <signal.h>
 static void ctrlc_handler(int signo)
@@ -12,10 +22,458 @@ static void ctrlc_handler(int signo)
 	if( signo == SIGINT ){
 		g_bRequestStop = true;
 	}
+	else if( signo == SIGUSR1 ){
+		g_bRequestProfile = true;
+	}
+	return;
+}
+/** 異常終了する前に実行記録を書き出す
+ */
+static void crash_handler(int signo)
+{
+	if( g_pTrace != nullptr )
+		g_pTrace->Dump(g_TracePath.c_str());
+	signal(signo, SIG_DFL);
+	raise(signo);
 	return;
 }
 #endif
 
+// 演奏リストを使うときの、1曲あたりのループ回数の既定値
+static const uint8_t PLAYLIST_LOOPS = 2;
+// --trace で記録する命令数（1命令32バイト）
+static const size_t TRACE_RECORDS = 256*1024;
+// 1フレームの時間[us]
+static const int FRAME_TIME_US = 16600;
+// リアルタイム実行時に、演奏前に触っておくスタックの大きさ
+static const size_t PREFAULT_STACK_SIZE = 256*1024;
+// 起床の遅れを測るときの周期[ns]
+static const int64_t LATENCY_TEST_PERIOD_NS = 1000*1000;
+
+static void usage()
+{
+	std::wcout << _T(" USAGE: hopstepz [-l loops|-f loops] [-s [min:]sec] [-k frames] [-c real|virtual] [-p wait|timi] [-x rate] [-m kbytes] \"mgsdrv.com\" \"file.MGS\" [\"file.MGS\"|dir|list.m3u ...]\n");
+	std::wcout << _T("        hopstepz -d \"socket\" [-l loops|-f loops] [-m kbytes] \"mgsdrv.com\" [\"file.MGS\"|dir|list.m3u ...]\n");
+	std::wcout << _T("        hopstepz -i \"index\" \"mgsdrv.com\" dir [dir ...]\n");
+	std::wcout << _T("        hopstepz [-r prio[:cpu]] -t sec\n");
+	std::wcout << _T("        hopstepz -b sec\n");
+	std::wcout << _T("        -r, --realtime prio[:cpu[,outcpu]] : SCHED_FIFO priority, CPU cores to pin (Linux)\n");
+	std::wcout << _T("        -k frames : emulate up to this many frames ahead of the chip output (0-16)\n");
+	std::wcout << _T("        -c real|virtual : time source of the system timer (virtual = emulated cycles)\n");
+	std::wcout << _T("        -p wait|timi : call MGS_INTER from the player loop, or from H.TIMI on VSYNC interrupts\n");
+	std::wcout << _T("        -x rate : playback speed (0.25-4, pitch is unchanged)\n");
+	std::wcout << _T("        -m kbytes : size of the memory mapper RAM (64-4096, default 256)\n");
+	std::wcout << _T("        --trace file : record the last Z80 instructions, written on exit, crash or SIGUSR1\n");
+	std::wcout << _T("        -b sec : measure the Z80 emulation speed with synthetic code\n\n");
+	return;
+}
+
+/** リアルタイム実行の設定をする。できなかった設定は理由を表示して、そのまま続ける
+ * @param pMsx 演奏前に触っておくエミュレータ（nullptr可）
+ */
+static void applyRealtime(CHopStepZ *pMsx, const int priority, const int cpu)
+{
+	std::string reason;
+	const bool bLocked = CRealtime::LockMemory(&reason);
+	if( !bLocked )
+		::wprintf(_T("REALTIME: %hs, memory is not locked\n"), reason.c_str());
+	if( pMsx != nullptr )
+		pMsx->Prefault();
+	CRealtime::PrefaultStack(PREFAULT_STACK_SIZE);
+	bool bPinned = false;
+	if( 0 <= cpu ){
+		bPinned = CRealtime::SetThreadAffinity(cpu, &reason);
+		if( !bPinned )
+			::wprintf(_T("REALTIME: %hs, not pinned\n"), reason.c_str());
+	}
+	if( !CRealtime::SetThreadPriority(priority, &reason) ){
+		::wprintf(_T("REALTIME: %hs, using normal scheduling\n"), reason.c_str());
+		return;
+	}
+	::wprintf(_T("REALTIME: SCHED_FIFO priority %d"), priority);
+	if( bPinned )
+		::wprintf(_T(", cpu %d"), cpu);
+	::wprintf(_T("%ls\n"), bLocked ? _T(", memory locked") : _T(""));
+	return;
+}
+
+/** 起床の遅れを測って表示する
+ */
+static int runLatencyTest(const int sec)
+{
+	::wprintf(_T("Measuring wake-up latency for %d sec...\n"), sec);
+	CRealtime::LATENCY lat;
+	if( !CRealtime::MeasureLatency(sec, LATENCY_TEST_PERIOD_NS, &lat) ){
+		::wprintf(_T("Not supported on this platform\n"));
+		return EXIT_FAILURE;
+	}
+	::wprintf(_T("samples %u, min %lldus, avg %lldus, max %lldus, >=100us %u, >=1ms %u\n"),
+		lat.Samples,
+		static_cast<long long>(lat.MinNs / 1000),
+		static_cast<long long>(lat.AvgNs / 1000),
+		static_cast<long long>(lat.MaxNs / 1000),
+		lat.Over100us, lat.Over1ms);
+	return EXIT_SUCCESS;
+}
+
+/** 合成した命令列を繰り返し実行して、１秒あたりに実行できた命令数を測る
+ * 外側のループの回数は BENCH_COUNTER に置く（0=256回）。
+ */
+static const z80memaddr_t BENCH_COUNTER = 0x0180;
+static int runBenchmark(const int sec)
+{
+	struct BENCH
+	{
+		const TCHAR				*pName;
+		std::vector<uint8_t>	Code;
+	};
+	const BENCH benches[] = {
+		{	_T("EXX / EX AF,AF'"), {
+			0x21, 0x34, 0x12,	//		LD HL,1234h
+			0x11, 0x78, 0x56,	//		LD DE,5678h
+			0x01, 0x00, 0x00,	//		LD BC,0000h
+			0xD9, 0x08,			// L1:	EXX / EX AF,AF'
+			0xD9, 0x08,
+			0xD9, 0x08,
+			0xD9, 0x08,
+			0x10, 0xF6,			//		DJNZ L1
+			0x3A, 0x80, 0x01,	//		LD A,(BENCH_COUNTER)
+			0x3D,				//		DEC A
+			0x32, 0x80, 0x01,	//		LD (BENCH_COUNTER),A
+			0x20, 0xED,			//		JR NZ,L1
+			0xC9 } },			//		RET
+		{	_T("16bit arithmetic"), {
+			0x21, 0x00, 0x00,	//		LD HL,0000h
+			0x11, 0x01, 0x00,	//		LD DE,0001h
+			0x01, 0x03, 0x00,	//		LD BC,0003h
+			0x3E, 0x00,			// L1:	LD A,0
+			0x09,				// L2:	ADD HL,BC
+			0x19,				//		ADD HL,DE
+			0x03,				//		INC BC
+			0x1B,				//		DEC DE
+			0xE5,				//		PUSH HL
+			0xD1,				//		POP DE
+			0xED, 0x4A,			//		ADC HL,BC
+			0xED, 0x52,			//		SBC HL,DE
+			0x23,				//		INC HL
+			0xEB,				//		EX DE,HL
+			0x3D,				//		DEC A
+			0x20, 0xF1,			//		JR NZ,L2
+			0x3A, 0x80, 0x01,	//		LD A,(BENCH_COUNTER)
+			0x3D,				//		DEC A
+			0x32, 0x80, 0x01,	//		LD (BENCH_COUNTER),A
+			0x20, 0xE6,			//		JR NZ,L1
+			0xC9 } },			//		RET
+		{	_T("memory copy"), {
+			0x21, 0x00, 0x80,	// L1:	LD HL,8000h
+			0x11, 0x00, 0xA0,	//		LD DE,A000h
+			0x06, 0x00,			//		LD B,0
+			0x7E,				// L2:	LD A,(HL)
+			0x12,				//		LD (DE),A
+			0x23,				//		INC HL
+			0x13,				//		INC DE
+			0x10, 0xFA,			//		DJNZ L2
+			0x3A, 0x80, 0x01,	//		LD A,(BENCH_COUNTER)
+			0x3D,				//		DEC A
+			0x32, 0x80, 0x01,	//		LD (BENCH_COUNTER),A
+			0x20, 0xE9,			//		JR NZ,L1
+			0xC9 } },			//		RET
+	};
+#if defined(Z80_UNION_REGS)
+	::wprintf(_T("Register layout: union pairs\n"));
+#else
+	::wprintf(_T("Register layout: separate 8bit registers\n"));
+#endif
+	CHopStepZ *pMsx = GCC_NEW CHopStepZ();
+	pMsx->Setup(true);
+	pMsx->SetClockMode(CMsxClock::MODE_VIRTUAL);
+	// メモリ装置を直接呼び出す場合と、仮想関数で呼び出す場合のそれぞれで測る
+	for( auto &b : benches ){
+		pMsx->MemoryWrite(0x0100, b.Code);
+		for( int s = 0; s < 2; ++s ){
+			const bool bStatic = (s == 0);
+			pMsx->SetStaticDispatch(bStatic);
+			const uint64_t inst0 = pMsx->GetInstCount();
+			const uint64_t t0 = CFrameProfiler::Now();
+			uint64_t t = t0;
+			while( t - t0 < static_cast<uint64_t>(sec) * 1000000000ULL && !g_bRequestStop ){
+				pMsx->MemoryWrite(BENCH_COUNTER, 0x00);
+				pMsx->Run(0x0100, 0xD400, &g_bRequestStop);
+				t = CFrameProfiler::Now();
+			}
+			const uint64_t inst = pMsx->GetInstCount() - inst0;
+			::wprintf(_T("%-18ls %-7ls: %llu instructions, %.2f M instructions/sec\n"),
+				b.pName, bStatic ? _T("static") : _T("virtual"), static_cast<unsigned long long>(inst),
+				static_cast<double>(inst) * 1000.0 / static_cast<double>(t - t0));
+		}
+	}
+	pMsx->SetStaticDispatch(true);
+	NULL_DELETE(pMsx);
+	return EXIT_SUCCESS;
+}
+
+/** フレーム数を 分:秒 で表示する
+ */
+static void printTime(const uint32_t frames)
+{
+	const uint32_t sec = static_cast<uint32_t>(static_cast<uint64_t>(frames) * FRAME_TIME_US / 1000000);
+	::wprintf(_T("%3u:%02u"), sec/60, sec%60);
+	return;
+}
+
+/** ディレクトリ以下のMGSファイルのインデックスを作って（更新して）、一覧を表示する
+ */
+static int runIndexer(
+	const tstring &indexPath, const std::vector<tstring> &dirs,
+	const std::vector<uint8_t> &driver, const std::vector<uint8_t> &player)
+{
+	CIndexer indexer(driver, player);
+	indexer.Load(indexPath);
+	for( auto &dir : dirs ){
+		if( !indexer.AddDirectory(dir) )
+			std::wcout << _T("Not found ") << dir << _T("\n");
+	}
+	indexer.Update(&g_bRequestStop);
+	if( !indexer.Save(indexPath) ){
+		std::wcout << _T("Could not write ") << indexPath << _T("\n");
+		return EXIT_FAILURE;
+	}
+	for( auto &e : indexer.GetEntries() ){
+		switch(e.Status)
+		{
+			case HSZINDEXENTRY::STATUS_OK:
+				printTime(e.IntroFrames + e.LoopFrames);
+				::wprintf(_T(" ("));
+				printTime(e.IntroFrames);
+				::wprintf(_T(" +"));
+				printTime(e.LoopFrames);
+				::wprintf(_T(")"));
+				break;
+			case HSZINDEXENTRY::STATUS_TIMEOUT:
+				::wprintf(_T(" (too long)          "));
+				break;
+			default:
+				::wprintf(_T(" (error)             "));
+				break;
+		}
+		::wprintf(_T(" %ls\t%ls\n"), e.Title.c_str(), e.Path.c_str());
+	}
+	::wprintf(_T("\n%zu songs, %zu measured\n"), indexer.GetEntries().size(), indexer.GetNumMeasured());
+	return EXIT_SUCCESS;
+}
+
+/** 演奏データとプレイヤープログラムをロードして、再生開始の準備をする
+ */
+static void loadSong(CHopStepZ *pMsx, const std::vector<uint8_t> &mgs, const std::vector<uint8_t> &player)
+{
+	pMsx->MemoryWrite(0x8000, mgs);
+	pMsx->MemoryWrite(0x0100, player);
+	pMsx->Start(0x0100, 0xD400);
+	return;
+}
+
+/** フレームの待ち合わせの統計を表示する
+ */
+static void printFrameStats(const CFrameScheduler::STATS &st)
+{
+	if( st.Frames == 0 )
+		return;
+	::wprintf(_T("FRAMES: %llu, late %llu, resync %llu, max late %lldus, avg late %lldus\n"),
+		static_cast<unsigned long long>(st.Frames),
+		static_cast<unsigned long long>(st.LateFrames),
+		static_cast<unsigned long long>(st.Resyncs),
+		static_cast<long long>(st.MaxLateNs / 1000),
+		static_cast<long long>(st.TotalLateNs / static_cast<int64_t>(st.Frames) / 1000));
+	::wprintf(_T("TEMPO: %.2f%%, overload frames %llu\n"),
+		CFrameScheduler::TempoAccuracy(st),
+		static_cast<unsigned long long>(st.OverloadFrames));
+	return;
+}
+
+/** 実行記録を取っていれば、ファイルに書き出す
+ */
+static void dumpTrace()
+{
+	if( g_pTrace == nullptr )
+		return;
+	if( g_pTrace->Dump(g_TracePath.c_str()) )
+		::wprintf(_T("TRACE: %hs\n"), g_TracePath.c_str());
+	else
+		::wprintf(_T("TRACE: could not write %hs\n"), g_TracePath.c_str());
+	return;
+}
+
+/** SIGUSR1 を受けていたら、処理時間の内訳を表示する（演奏スレッドから呼ぶ）
+ */
+static void checkProfileRequest(const CHopStepZ *pMsx)
+{
+	if( !g_bRequestProfile.exchange(false) )
+		return;
+	::wprintf(_T("\n"));
+	pMsx->PrintProfile();
+	dumpTrace();
+	return;
+}
+
+/** 演奏リストの曲を順番に演奏する
+ */
+static void runPlayList(
+	CHopStepZ *pMsx, CPlayList &playList, const std::vector<uint8_t> &player, const uint32_t startFrame)
+{
+	// 常駐したMGSDRVはそのままにして、PLAYER.COMだけを曲ごとに起動し直す
+	playList.Prefetch(0);
+	for( size_t songNo = 0; songNo < playList.GetNum() && !g_bRequestStop; ++songNo ){
+		std::vector<uint8_t> *pMgsFile = nullptr;
+		const bool bLoaded = playList.Take(songNo, &pMgsFile);
+		playList.Prefetch(songNo+1);
+		if( !bLoaded ) {
+			std::wcout << _T("Not found ") << playList.GetPath(songNo) << _T("\n");
+			NULL_DELETE(pMgsFile);
+			continue;
+		}
+#ifdef __linux
+		tstring title;
+		CIndexer::GetTitle(&title, *pMgsFile);
+		::wprintf(_T("PLAY:\n%ls\n"), title.c_str());
+#endif
+		loadSong(pMsx, *pMgsFile, player);
+		bool bPlay = (startFrame == 0) || pMsx->Seek(startFrame, &g_bRequestStop);
+		while( bPlay && pMsx->RunFrame(&g_bRequestStop) )
+			checkProfileRequest(pMsx);
+		pMsx->Mute();
+		NULL_DELETE(pMgsFile);
+	}
+	return;
+}
+
+/** 制御用ソケットからのコマンドに従って演奏する
+ */
+static int runDaemon(
+	CHopStepZ *pMsx, CPlayList &playList, const std::vector<uint8_t> &player, const tstring &sockPath)
+{
+	CControlServer server;
+	if( !server.Start(sockPath) ){
+		std::wcout << _T("Could not open the control socket ") << sockPath << _T("\n");
+		return EXIT_FAILURE;
+	}
+	std::wcout << _T("Listening on ") << sockPath << _T("\n");
+	server.SetRate(static_cast<int>(pMsx->GetPlaybackRate() * 100 + 0.5));
+
+	size_t songNo = 0;
+	CControlServer::STATE state = CControlServer::STATE_STOPPED;
+	// 読めない曲は飛ばして、no 番目以降で最初に読めた曲を演奏する
+	auto startSong = [&](size_t no) -> bool {
+		pMsx->Mute();
+		state = CControlServer::STATE_STOPPED;
+		server.SetState(state);
+		for( ; no < playList.GetNum(); ++no ){
+			std::vector<uint8_t> *pMgsFile = nullptr;
+			const bool bLoaded = playList.Take(no, &pMgsFile);
+			playList.Prefetch(no+1);
+			songNo = no;
+			if( !bLoaded ){
+				std::wcout << _T("Not found ") << playList.GetPath(no) << _T("\n");
+				NULL_DELETE(pMgsFile);
+				continue;
+			}
+			tstring title;
+			CIndexer::GetTitle(&title, *pMgsFile);
+			server.SetSong(static_cast<int>(no), static_cast<int>(playList.GetNum()), title);
+			loadSong(pMsx, *pMgsFile, player);
+			state = CControlServer::STATE_PLAYING;
+			server.SetState(state);
+			NULL_DELETE(pMgsFile);
+			return true;
+		}
+		return false;
+	};
+	if( 0 < playList.GetNum() )
+		startSong(0);
+
+	bool bQuit = false;
+	while( !bQuit && !g_bRequestStop ){
+		// コマンドは1フレームに1回まとめて処理する
+		HSZCOMMAND cmd;
+		while( server.PopCommand(&cmd) ){
+			switch(cmd.Type)
+			{
+				case HSZCOMMAND::PLAY:
+					if( !cmd.Path.empty() ){
+						const size_t no = playList.GetNum();
+						if( playList.Add(cmd.Path) )
+							startSong(no);
+					}
+					else if( state == CControlServer::STATE_PAUSED ){
+						pMsx->Resume();
+						state = CControlServer::STATE_PLAYING;
+					}
+					else if( state == CControlServer::STATE_STOPPED )
+						startSong(songNo);
+					break;
+				case HSZCOMMAND::STOP:
+					pMsx->Mute();
+					state = CControlServer::STATE_STOPPED;
+					break;
+				case HSZCOMMAND::NEXT:
+					startSong((songNo+1 < playList.GetNum()) ? songNo+1 : 0);
+					break;
+				case HSZCOMMAND::PAUSE:
+					if( state == CControlServer::STATE_PLAYING ){
+						pMsx->Pause();
+						state = CControlServer::STATE_PAUSED;
+					}
+					break;
+				case HSZCOMMAND::RESUME:
+					if( state == CControlServer::STATE_PAUSED ){
+						pMsx->Resume();
+						state = CControlServer::STATE_PLAYING;
+					}
+					break;
+				case HSZCOMMAND::VOLUME:
+					pMsx->SetMasterVolume(cmd.Value, state != CControlServer::STATE_STOPPED);
+					server.SetVolume(cmd.Value);
+					break;
+				case HSZCOMMAND::RATE:
+					pMsx->SetPlaybackRate(cmd.Value / 100.0);
+					server.SetRate(cmd.Value);
+					break;
+				case HSZCOMMAND::QUIT:
+					bQuit = true;
+					break;
+				case HSZCOMMAND::SEEK:
+					if( state != CControlServer::STATE_STOPPED ){
+						state = CControlServer::STATE_PLAYING;
+						if( !pMsx->Seek(static_cast<uint32_t>(cmd.Value), &g_bRequestStop) && !g_bRequestStop ){
+							if( !startSong(songNo+1) )
+								pMsx->Mute();
+						}
+					}
+					break;
+				default:
+					break;
+			}
+			server.SetState(state);
+		}
+
+		if( state == CControlServer::STATE_PLAYING ){
+			if( !pMsx->RunFrame(&g_bRequestStop) && !g_bRequestStop ){
+				// 曲が終わったら次の曲へ
+				if( !startSong(songNo+1) )
+					pMsx->Mute();
+			}
+			server.SetFrame(pMsx->GetFrameCount());
+			server.SetTempo(pMsx->GetTempoAccuracy());
+		}
+		else{
+			t_sleep(16);
+		}
+		checkProfileRequest(pMsx);
+	}
+	pMsx->Mute();
+	server.Stop();
+	return EXIT_SUCCESS;
+}
+
 #ifdef _WIN32
 int _tmain(int argc, _TCHAR *argv[])
 #endif
@@ -25,26 +483,146 @@ int main(int argc, char *argv[])
 {
 	setlocale(LC_ALL, "");
 	std::wcout << _T("\n") << _T("HopStepZ version 1.10 by @harumakkin. 2021\n");
-	if( argc != 3 ){
-		std::wcout << _T(" USAGE: hopstepz \"mgsdrv.com\" \"file.MGS\"\n\n");
+	std::vector<tstring> args;
+	for( int t = 1; t < argc; ++t ){
+#ifdef _WIN32
+		args.push_back(tstring(argv[t]));
+#endif
+#ifdef __linux
+		tstring arg;
+		t_ToWiden(argv[t], &arg);
+		args.push_back(arg);
+#endif
+	}
+	int loops = -1;
+	int fadeLoops = 0;
+	uint32_t startFrame = 0;
+	tstring sockPath;
+	tstring indexPath;
+	int rtPriority = 0;		// 0=リアルタイム実行しない
+	int rtCpu = -1;
+	int rtOutCpu = -1;		// 出力スレッドを固定するコア
+	int lookahead = 0;
+	int latencySec = 0;
+	int benchSec = 0;
+	CMsxClock::MODE clockMode = CMsxClock::MODE_REALTIME;
+	bool bVsync = false;	// true=VSYNC割り込みで H.TIMI から演奏する
+	double rate = 1.0;		// 演奏の速さ
+	int mapperSegments = 16;	// メモリマッパのセグメント数(16KBytes単位)
+	size_t argi = 0;
+	while( argi+1 < args.size() && args[argi][0] == _T('-') ){
+		if( args[argi] == _T("-l") )
+			loops = t_Trimer(_tstoi(args[argi+1].c_str()), 1, 0xff);
+		else if( args[argi] == _T("-f") )
+			fadeLoops = t_Trimer(_tstoi(args[argi+1].c_str()), 1, 0xfe);
+		else if( args[argi] == _T("-s") ){
+			std::string str;
+			t_ToNarrow(args[argi+1], &str);
+			double sec;
+			if( !t_ParseTime(str, &sec) ){
+				usage();
+				return EXIT_FAILURE;
+			}
+			startFrame = static_cast<uint32_t>(sec * 1000000 / FRAME_TIME_US);
+		}
+		else if( args[argi] == _T("-d") )
+			sockPath = args[argi+1];
+		else if( args[argi] == _T("-i") )
+			indexPath = args[argi+1];
+		else if( args[argi] == _T("-r") || args[argi] == _T("--realtime") ){
+			std::vector<tstring> vals;
+			t_CreateStringArray(_T(":"), args[argi+1], &vals);
+			rtPriority = t_Trimer(_tstoi(vals[0].c_str()), 1, 99);
+			if( 1 < vals.size() ){
+				std::vector<tstring> cpus;
+				t_CreateStringArray(_T(","), vals[1], &cpus);
+				rtCpu = _tstoi(cpus[0].c_str());
+				rtOutCpu = (1 < cpus.size()) ? _tstoi(cpus[1].c_str()) : rtCpu;
+			}
+		}
+		else if( args[argi] == _T("-k") )
+			lookahead = t_Trimer(_tstoi(args[argi+1].c_str()), 0, CChipPipeline::MAX_LOOKAHEAD);
+		else if( args[argi] == _T("-c") ){
+			if( args[argi+1] == _T("real") )
+				clockMode = CMsxClock::MODE_REALTIME;
+			else if( args[argi+1] == _T("virtual") )
+				clockMode = CMsxClock::MODE_VIRTUAL;
+			else{
+				usage();
+				return EXIT_FAILURE;
+			}
+		}
+		else if( args[argi] == _T("-p") ){
+			if( args[argi+1] == _T("wait") )
+				bVsync = false;
+			else if( args[argi+1] == _T("timi") )
+				bVsync = true;
+			else{
+				usage();
+				return EXIT_FAILURE;
+			}
+		}
+		else if( args[argi] == _T("-x") ){
+			rate = _tstof(args[argi+1].c_str());
+			if( rate < 0.25 || 4.0 < rate ){
+				usage();
+				return EXIT_FAILURE;
+			}
+		}
+		else if( args[argi] == _T("--trace") )
+			t_ToNarrow(args[argi+1], &g_TracePath);
+		else if( args[argi] == _T("-m") )
+			mapperSegments = t_Trimer(_tstoi(args[argi+1].c_str()), 64, 4096) / 16;
+		else if( args[argi] == _T("-t") )
+			latencySec = t_Trimer(_tstoi(args[argi+1].c_str()), 1, 3600);
+		else if( args[argi] == _T("-b") )
+			benchSec = t_Trimer(_tstoi(args[argi+1].c_str()), 1, 3600);
+		else
+			break;
+		argi += 2;
+	}
+	if( 0 < latencySec ){
+		if( 0 < rtPriority )
+			applyRealtime(nullptr, rtPriority, rtCpu);
+		return runLatencyTest(latencySec);
+	}
+	if( 0 < benchSec )
+		return runBenchmark(benchSec);
+	const bool bDaemon = !sockPath.empty();
+	const bool bIndexer = !indexPath.empty();
+	if( args.size() < argi + (bDaemon ? 1 : 2) ){
+		usage();
 		return EXIT_FAILURE;
 	}
+	const tstring argv1 = args[argi++];
+	CPlayList playList;
+	for( ; argi < args.size() && !bIndexer; ++argi ){
+		if( !playList.Add(args[argi]) )
+			std::wcout << _T("Not found ") << args[argi] << _T("\n");
+	}
+	if( playList.GetNum() == 0 && !bDaemon && !bIndexer ){
+		usage();
+		return EXIT_FAILURE;
+	}
+	if( loops < 0 )
+		loops = (playList.GetNum() == 1 && !bDaemon) ? 0xff : PLAYLIST_LOOPS;
+	if( 0 < fadeLoops )
+		loops = 0xff;	// 曲を終えるのはフェードアウトに任せる
 
 #ifdef _WIN32
 	timeBeginPeriod(1);
-	tstring argv1(argv[1]);
-	tstring argv2(argv[2]);
 #endif
 #ifdef __linux
-	tstring argv1;
-	tstring argv2;
-	t_ToWiden(argv[1], &argv1);
-	t_ToWiden(argv[2], &argv2);
-
 	struct sigaction act;
     memset(&act, 0, sizeof act);
     act.sa_handler = ctrlc_handler;
     sigaction(SIGINT, &act, NULL);
+    sigaction(SIGUSR1, &act, NULL);
+	if( !g_TracePath.empty() ){
+		act.sa_handler = crash_handler;
+		for( int signo : { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT } )
+			sigaction(signo, &act, NULL);
+	}
 #endif
 
 	auto *pComFile = GCC_NEW std::vector<uint8_t>();
@@ -52,48 +630,70 @@ int main(int argc, char *argv[])
 		std::wcout << _T("Not found ") << argv1 << _T("\n");
 		return EXIT_FAILURE;
 	}
-	auto *pMgsFile = GCC_NEW std::vector<uint8_t>();
-	if( !t_ReadFile(argv2, &pMgsFile) ) {
-		std::wcout << _T("Not found ") << argv2 << _T("\n");
-		return EXIT_FAILURE;
-	}
 	auto *pPlayerFile = GCC_NEW std::vector<uint8_t>();
 	if( t_ReadFile(tstring(_T("PLAYER.COM.HSZ")), &pPlayerFile) ) {
 		std::wcout << _T("Use \"") << _T("PLAYER.COM.HSZ") << _T("\"\n");
 	}
+	else if( bVsync && !bIndexer ){
+		GetBinaryPlayerComTimi(pPlayerFile);
+	}
 	else{
 		GetBinaryPlayerCom(pPlayerFile);
 	}
 
+	if( bIndexer ){
+		const std::vector<tstring> dirs(args.begin()+argi, args.end());
+		int ret = runIndexer(indexPath, dirs, *pComFile, *pPlayerFile);
+		NULL_DELETE(pPlayerFile);
+		NULL_DELETE(pComFile);
+#ifdef _WIN32
+		timeEndPeriod(1);
+#endif
+		return ret;
+	}
+
 	CHopStepZ *pMsx = GCC_NEW CHopStepZ();
-	pMsx->Setup();
+	pMsx->Setup(false, mapperSegments);
+	if( !g_TracePath.empty() ){
+		g_pTrace = GCC_NEW CZ80Trace(TRACE_RECORDS);
+		pMsx->SetTrace(g_pTrace);
+	}
 
-	// MGSDRV.COMを実行して常駐させる
+	// MGSDRV.COMを実行して常駐させる（初期化の待ちループは仮想時刻で飛ばす）
+	pMsx->SetClockMode(CMsxClock::MODE_VIRTUAL);
 	pMsx->MemoryWrite(0x0100, *pComFile);
 	pMsx->Run(0x0100, 0xD400, &g_bRequestStop);
+	pMsx->SetClockMode(clockMode);
+	pMsx->SetLoopCount(static_cast<uint8_t>(loops));
+	pMsx->SetFadeLoops(fadeLoops);
+	pMsx->SetVsyncInterrupt(bVsync);
+	pMsx->SetPlaybackRate(rate);
+	if( 0 < rtPriority )
+		applyRealtime(pMsx, rtPriority, rtCpu);
+	pMsx->StartPipeline(lookahead, rtPriority, rtOutCpu);
 
-#ifdef __linux
-	tstring title;
-	auto *pMs = reinterpret_cast<char*>(pMgsFile->data());
-	size_t ssz = strlen(pMs);
-	t_FromSjis(&title, pMs, ssz);
-	::wprintf(_T("PLAY:\n%ls\n"), title.c_str());
-#endif
-
-	// 演奏データとプレイヤープログラムをロードして再生開始
-	pMsx->MemoryWrite(0x8000, *pMgsFile);
-	pMsx->MemoryWrite(0x0100, *pPlayerFile);
-	pMsx->Run(0x0100, 0xD400, &g_bRequestStop);
+	int ret = EXIT_SUCCESS;
+	if( bDaemon )
+		ret = runDaemon(pMsx, playList, *pPlayerFile, sockPath);
+	else
+		runPlayList(pMsx, playList, *pPlayerFile, startFrame);
 	::wprintf(_T("\nSTOP\n"));
+	dumpTrace();
+	pMsx->StopPipeline();
+	printFrameStats(pMsx->GetFrameStats());
+	if( 0 < pMsx->GetSkippedWrites() )
+		::wprintf(_T("SKIPPED WRITES: %llu\n"), static_cast<unsigned long long>(pMsx->GetSkippedWrites()));
+	pMsx->PrintProfile();
 
 
-	NULL_DELETE(pMgsFile);
+	NULL_DELETE(pPlayerFile);
 	NULL_DELETE(pComFile);
 	NULL_DELETE(pMsx);
+	NULL_DELETE(g_pTrace);
 
 #ifdef _WIN32
 	timeEndPeriod(1);
 #endif
-	return EXIT_SUCCESS;
+	return ret;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <stddef.h>
 
 typedef uint8_t		z80ioaddr_t;
 typedef uint16_t	z80memaddr_t;
@@ -14,6 +15,26 @@ public:
 public:
 	virtual bool WriteMem(const z80memaddr_t addr, const uint8_t b) = 0;
 	virtual uint8_t ReadMem(const z80memaddr_t addr) const = 0;
+	// 連続した領域の読み書き（addr から size バイト。同じページの中で呼び出される）
+	// 既定では１バイトずつ読み書きする。RAM などはまとめて行う。
+	virtual void WriteBlock(const z80memaddr_t addr, const uint8_t *pSrc, const size_t size)
+	{
+		for( size_t t = 0; t < size; ++t )
+			WriteMem(static_cast<z80memaddr_t>(addr + t), pSrc[t]);
+		return;
+	}
+	virtual void ReadBlock(uint8_t *pDest, const z80memaddr_t addr, const size_t size) const
+	{
+		for( size_t t = 0; t < size; ++t )
+			pDest[t] = ReadMem(static_cast<z80memaddr_t>(addr + t));
+		return;
+	}
+	virtual void FillBlock(const z80memaddr_t addr, const uint8_t b, const size_t size)
+	{
+		for( size_t t = 0; t < size; ++t )
+			WriteMem(static_cast<z80memaddr_t>(addr + t), b);
+		return;
+	}
 };
 
 class IZ80IoDevice
@@ -23,6 +44,8 @@ public:
 public:
 	virtual bool OutPort(const z80ioaddr_t addr, const uint8_t b) = 0;
 	virtual bool InPort(uint8_t *pB, const z80ioaddr_t addr) = 0;
+	// このI/Oポートを受け持つなら true（CMsxIoSystem::JoinObject() でポートごとの呼び出し先を決める）
+	virtual bool HasPort(const z80ioaddr_t addr) const = 0;
 };
 
 
@@ -16,6 +16,8 @@
 	; Hopstepz sub-routines
 	ST16MS		:= 0x0039
 	WT16MS		:= 0x003A
+	SETMGSWK	:= 0x003B
+	GETLOOPCT	:= 0x003C
 
 		org	0x100
 
@@ -26,6 +28,7 @@
 		out		[0xfd], a
 
 		call	MGS_SYSCK
+		call	SETMGSWK		; IX=MGSDRVのワークエリアをHopstepzへ教える
 		call	MGS_INITM
 
 	volume_max:
@@ -35,7 +38,7 @@
 
 	start_play:
 		ld		de, 0x8000
-		ld		b, 0xff
+		call	GETLOOPCT		; B=ループ回数(0xFF=無限)をHopstepzからもらう
 		ld		hl, 0xffff
 		call	MGS_PLYST
 		ei
@@ -54,9 +57,9 @@
 */
 static const uint8_t g_player_com[] = 
 {
-	0xF3, 0x3E, 0x04, 0xD3, 0xFD, 0xCD, 0x10, 0x60, 0xCD, 0x13, 0x60, 0xAF, 0x06, 0x00, 0xCD, 0x22,
-	0x60, 0x11, 0x00, 0x80, 0x06, 0xFF, 0x21, 0xFF, 0xFF, 0xCD, 0x16, 0x60, 0xFB, 0xCD, 0x39, 0x00,
-	0xCD, 0x1F, 0x60, 0xCD, 0x3A, 0x00, 0x18, 0xF5,
+	0xF3, 0x3E, 0x04, 0xD3, 0xFD, 0xCD, 0x10, 0x60, 0xCD, 0x3B, 0x00, 0xCD, 0x13, 0x60, 0xAF, 0x06,
+	0x00, 0xCD, 0x22, 0x60, 0x11, 0x00, 0x80, 0xCD, 0x3C, 0x00, 0x21, 0xFF, 0xFF, 0xCD, 0x16, 0x60,
+	0xFB, 0xCD, 0x39, 0x00, 0xCD, 0x1F, 0x60, 0xCD, 0x3A, 0x00, 0x18, 0xF5,
 };
 
 void GetBinaryPlayerCom(std::vector<uint8_t> *pBin)
@@ -68,4 +71,60 @@ void GetBinaryPlayerCom(std::vector<uint8_t> *pBin)
 	return;
 }
 
+/*
+	;PLAYER.COM (H.TIMI)  #HopStepZ の VSYNC割り込み(-p timi)用
+	; 実機と同じように、H.TIMI から MGS_INTER を呼び出す。
+	; 割り込みは HopStepZ が Tステート数から 59736 ごとに発生させる。
+
+		org	0x100
+
+	scope playermgs_timi
+	begin:
+		di
+		ld		a, 4
+		out		[0xfd], a
+
+		call	MGS_SYSCK
+		call	SETMGSWK		; IX=MGSDRVのワークエリアをHopstepzへ教える
+		call	MGS_INITM
+
+	volume_max:
+		xor		a,a
+		ld		b,0
+		call	MGS_MSVST
+
+	start_play:
+		ld		de, 0x8000
+		call	GETLOOPCT		; B=ループ回数(0xFF=無限)をHopstepzからもらう
+		ld		hl, 0xffff
+		call	MGS_PLYST
+
+	set_hook:
+		ld		a, 0xc3			; H.TIMI <- jp MGS_INTER
+		ld		[0xfd9f], a
+		ld		hl, MGS_INTER
+		ld		[0xfda0], hl
+		ei
+
+	loop:
+		halt
+		jr		loop
+
+	endscope ; playermgs_timi
+*/
+static const uint8_t g_player_timi_com[] = 
+{
+	0xF3, 0x3E, 0x04, 0xD3, 0xFD, 0xCD, 0x10, 0x60, 0xCD, 0x3B, 0x00, 0xCD, 0x13, 0x60, 0xAF, 0x06,
+	0x00, 0xCD, 0x22, 0x60, 0x11, 0x00, 0x80, 0xCD, 0x3C, 0x00, 0x21, 0xFF, 0xFF, 0xCD, 0x16, 0x60,
+	0x3E, 0xC3, 0x32, 0x9F, 0xFD, 0x21, 0x1F, 0x60, 0x22, 0xA0, 0xFD, 0xFB, 0x76, 0x18, 0xFD,
+};
+
+void GetBinaryPlayerComTimi(std::vector<uint8_t> *pBin)
+{
+	pBin->clear();
+	size_t sz = sizeof(g_player_timi_com);
+	for( size_t t = 0; t < sz; ++t)
+		pBin->push_back(g_player_timi_com[t]);
+	return;
+}
 
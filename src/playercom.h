@@ -2,3 +2,4 @@
 #include "stdafx.h"
 #include <vector>
 void GetBinaryPlayerCom(std::vector<uint8_t> *pBin);
+void GetBinaryPlayerComTimi(std::vector<uint8_t> *pBin);
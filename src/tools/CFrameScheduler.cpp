@@ -0,0 +1,179 @@
+﻿#include "stdafx.h"
+#include "CFrameScheduler.h"
+#include <chrono>
+#include <thread>
+#ifdef __linux
+#include <time.h>
+#endif
+
+static const int64_t SPIN_NS = 150*1000;			// 期限のこの時間前からはスピンして待つ
+static const int64_t MAX_CATCHUP_FRAMES = 6;		// これ以上遅れたら取り戻すのをあきらめる
+static const int64_t LATE_NS = 1000*1000;			// 期限からこれ以上遅れたフレームを遅延として数える
+static const int AVG_SHIFT = 3;						// 遅れの移動平均の重み（1/8）
+static const int64_t OVERLOAD_ENTER_NS = 2000*1000;	// 遅れの移動平均がこれを超えたら過負荷とする
+static const int64_t OVERLOAD_LEAVE_NS = 300*1000;	// 過負荷の状態から戻る遅れの移動平均
+
+/**
+ * @param periodNs フレームの周期[ns]
+ */
+CFrameScheduler::CFrameScheduler(const int64_t periodNs) :
+	m_NextPeriodNs(periodNs), m_TempoPpm(1000000)
+{
+	m_PeriodNs = periodNs;
+	m_BaseNs = 0;
+	m_FrameIndex = 0;
+	m_bStarted = false;
+	memset(&m_Stats, 0, sizeof(m_Stats));
+	m_AvgLateNs = 0;
+	m_bOverloaded = false;
+	return;
+}
+
+CFrameScheduler::~CFrameScheduler()
+{
+	// do nothing
+	return;
+}
+
+/** 今をフレーム 0 の開始時刻にする
+ */
+void CFrameScheduler::Start()
+{
+	m_BaseNs = now();
+	m_FrameIndex = 0;
+	m_bStarted = true;
+	m_AvgLateNs = 0;
+	m_bOverloaded = false;
+	return;
+}
+
+/** 次の Start() まで待ち合わせをやめる（一時停止やシークの間など）
+ */
+void CFrameScheduler::Stop()
+{
+	m_bStarted = false;
+	return;
+}
+
+bool CFrameScheduler::IsStarted() const
+{
+	return m_bStarted;
+}
+
+/** 次のフレームの開始時刻まで待つ
+ * 期限を過ぎていたら待たずに戻る（MAX_CATCHUP_FRAMES までは、続くフレームを詰めて実行して取り戻す）。
+ * それ以上遅れたら基点を置き直し、その分はテンポの遅れとして LostNs に数える。
+ * @return 待つべきだった時間[ns]（期限を過ぎていたら 0 以下）
+ */
+int64_t CFrameScheduler::WaitNextFrame()
+{
+	if( !m_bStarted ){
+		Start();
+		return 0;
+	}
+	const int64_t period = m_NextPeriodNs.load(std::memory_order_relaxed);
+	if( period != m_PeriodNs ){
+		// 周期が変わったら、前のフレームの期限を基点にし直す
+		m_BaseNs += static_cast<int64_t>(m_FrameIndex) * m_PeriodNs;
+		m_FrameIndex = 0;
+		m_PeriodNs = period;
+	}
+	++m_FrameIndex;
+	const int64_t deadline = m_BaseNs + static_cast<int64_t>(m_FrameIndex) * m_PeriodNs;
+	int64_t t = now();
+	const int64_t requested = deadline - t;
+	if( t < deadline ){
+		if( SPIN_NS < deadline - t )
+			sleepUntil(deadline - SPIN_NS);
+		do {
+			t = now();
+		} while( t < deadline );
+	}
+	else if( MAX_CATCHUP_FRAMES * m_PeriodNs < t - deadline ){
+		m_BaseNs = t;
+		m_FrameIndex = 0;
+		++m_Stats.Resyncs;
+		m_Stats.LostNs += t - deadline;
+	}
+	const int64_t late = t - deadline;
+	// 遅れの移動平均で過負荷かどうかを決める（行ったり来たりしないように、戻る閾値は低くする）
+	m_AvgLateNs += (((0 < late) ? late : 0) - m_AvgLateNs) >> AVG_SHIFT;
+	if( !m_bOverloaded && OVERLOAD_ENTER_NS < m_AvgLateNs )
+		m_bOverloaded = true;
+	else if( m_bOverloaded && m_AvgLateNs < OVERLOAD_LEAVE_NS )
+		m_bOverloaded = false;
+	if( m_bOverloaded )
+		++m_Stats.OverloadFrames;
+	m_Stats.PlayedNs += m_PeriodNs;
+	m_TempoPpm.store(static_cast<uint32_t>(TempoAccuracy(m_Stats) * 10000), std::memory_order_relaxed);
+	if( LATE_NS < late )
+		++m_Stats.LateFrames;
+	++m_Stats.Frames;
+	m_Stats.TotalLateNs += late;
+	if( m_Stats.MaxLateNs < late )
+		m_Stats.MaxLateNs = late;
+	return requested;
+}
+
+/** フレームの周期を変える（どのスレッドから呼んでもよい）
+ */
+void CFrameScheduler::SetPeriod(const int64_t periodNs)
+{
+	m_NextPeriodNs.store(periodNs, std::memory_order_relaxed);
+	return;
+}
+
+const CFrameScheduler::STATS &CFrameScheduler::GetStats() const
+{
+	return m_Stats;
+}
+
+/** 遅れが続いていて、期限に間に合っていない
+ */
+bool CFrameScheduler::IsOverloaded() const
+{
+	return m_bOverloaded;
+}
+
+/** 今までのテンポの正確さ[%]（どのスレッドから呼んでもよい）
+ */
+double CFrameScheduler::GetTempoAccuracy() const
+{
+	return m_TempoPpm.load(std::memory_order_relaxed) / 10000.0;
+}
+
+/** テンポの正確さ[%] = 演奏した時間 / (演奏した時間 + 取り戻せなかった遅れ)
+ */
+double CFrameScheduler::TempoAccuracy(const STATS &st)
+{
+	if( st.PlayedNs <= 0 )
+		return 100.0;
+	return 100.0 * st.PlayedNs / (st.PlayedNs + st.LostNs);
+}
+
+int64_t CFrameScheduler::now()
+{
+#ifdef __linux
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void CFrameScheduler::sleepUntil(const int64_t t)
+{
+#ifdef __linux
+	struct timespec ts;
+	ts.tv_sec = static_cast<time_t>(t / 1000000000LL);
+	ts.tv_nsec = static_cast<long>(t % 1000000000LL);
+	while( clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR )
+		;
+#else
+	std::this_thread::sleep_until(
+		std::chrono::steady_clock::time_point(std::chrono::nanoseconds(t)));
+#endif
+	return;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+
+/** 一定周期のフレームの待ち合わせ
+ * 「前のフレームからの経過時間」ではなく「開始時刻 + フレーム番号 x 周期」を期限として待つので、
+ * 寝過ごしがあっても次のフレームで取り戻され、テンポがずれていかない。
+ * 6フレーム（MAX_CATCHUP_FRAMES）を超えて遅れたときは、取り戻すのをあきらめて基点を置き直す。
+ * 期限の少し手前まで寝て、残りはスピンして待つ。
+ * 遅れの移動平均を見ていて、遅れが続くときは IsOverloaded() で知らせる（呼び出し側で書き込みを間引くなどする）。
+ * 周期は SetPeriod() で演奏中に変えられる（次の待ち合わせから、その時点の期限を基点にして新しい周期で待つ）。
+ */
+class CFrameScheduler
+{
+public:
+	struct STATS
+	{
+		uint64_t	Frames;			// 待ち合わせた回数
+		uint64_t	LateFrames;		// 期限から 1ms 以上遅れた回数
+		uint64_t	Resyncs;		// 遅れを取り戻すのをあきらめて基点を置き直した回数
+		int64_t		MaxLateNs;		// 期限からの遅れの最大値
+		int64_t		TotalLateNs;	// 期限からの遅れの合計
+		int64_t		PlayedNs;		// 待ち合わせたフレームの時間の合計（フレーム数 x 周期）
+		int64_t		LostNs;			// 基点を置き直して取り戻せなかった遅れの合計
+		uint64_t	OverloadFrames;	// IsOverloaded() だったフレーム数
+	};
+
+private:
+	int64_t		m_PeriodNs;
+	std::atomic<int64_t>	m_NextPeriodNs;	// SetPeriod()で指定された周期（他のスレッドから書く用）
+	int64_t		m_BaseNs;
+	uint64_t	m_FrameIndex;
+	bool		m_bStarted;
+	STATS		m_Stats;
+	int64_t		m_AvgLateNs;		// 遅れの移動平均
+	bool		m_bOverloaded;
+	std::atomic<uint32_t>	m_TempoPpm;	// TempoAccuracy() の値 [ppm]（他のスレッドから読む用）
+
+public:
+	explicit CFrameScheduler(const int64_t periodNs);
+	virtual ~CFrameScheduler();
+
+public:
+	void Start();
+	void Stop();
+	bool IsStarted() const;
+	int64_t WaitNextFrame();
+	void SetPeriod(const int64_t periodNs);
+	const STATS &GetStats() const;
+	bool IsOverloaded() const;
+	double GetTempoAccuracy() const;
+	static double TempoAccuracy(const STATS &st);
+
+private:
+	static int64_t now();
+	static void sleepUntil(const int64_t t);
+};
@@ -0,0 +1,75 @@
+﻿#include "stdafx.h"
+#include "CHistogram.h"
+
+CHistogram::CHistogram()
+{
+	Reset();
+	return;
+}
+
+CHistogram::~CHistogram()
+{
+	// do nothing
+	return;
+}
+
+void CHistogram::Reset()
+{
+	for( int t = 0; t < NUM_BUCKETS; ++t )
+		m_Buckets[t].store(0, std::memory_order_relaxed);
+	m_Count.store(0, std::memory_order_relaxed);
+	m_Total.store(0, std::memory_order_relaxed);
+	m_Max.store(0, std::memory_order_relaxed);
+	return;
+}
+
+uint64_t CHistogram::GetCount() const
+{
+	return m_Count.load(std::memory_order_relaxed);
+}
+
+uint64_t CHistogram::GetMax() const
+{
+	return m_Max.load(std::memory_order_relaxed);
+}
+
+uint64_t CHistogram::GetMean() const
+{
+	const uint64_t cnt = GetCount();
+	return (cnt == 0) ? 0 : m_Total.load(std::memory_order_relaxed) / cnt;
+}
+
+/** percent[%] の値（その値が入っているバケットの上限。最大値を超えない）
+ */
+uint64_t CHistogram::GetPercentile(const double percent) const
+{
+	const uint64_t cnt = GetCount();
+	if( cnt == 0 )
+		return 0;
+	uint64_t target = static_cast<uint64_t>(percent / 100.0 * static_cast<double>(cnt) + 0.5);
+	if( target == 0 )
+		target = 1;
+	const uint64_t maxv = GetMax();
+	uint64_t sum = 0;
+	for( int t = 0; t < NUM_BUCKETS; ++t ){
+		sum += m_Buckets[t].load(std::memory_order_relaxed);
+		if( target <= sum ){
+			if( t+1 == NUM_BUCKETS )
+				return maxv;
+			const uint64_t high = bucketLowest(t+1) - 1;
+			return (high < maxv) ? high : maxv;
+		}
+	}
+	return maxv;
+}
+
+/** バケット idx に入る最小の値
+ */
+uint64_t CHistogram::bucketLowest(const int idx)
+{
+	if( idx < SUB_NUM )
+		return static_cast<uint64_t>(idx);
+	const int e = idx / SUB_NUM + SUB_BITS - 1;
+	const uint64_t sub = static_cast<uint64_t>(idx % SUB_NUM);
+	return (SUB_NUM + sub) << (e - SUB_BITS);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+
+/** 値の分布を記録するヒストグラム（HDR Histogram と同じ対数線形のバケット）
+ * 2のべき乗の区間ごとに 32 分割したバケットに数えるので、どの値でも誤差は 1/32 以内に収まる。
+ * 記録するのは１スレッドだけとし、読み出しは他のスレッドからでもロック無しでできる。
+ */
+class CHistogram
+{
+private:
+	static const int SUB_BITS = 5;
+	static const int SUB_NUM = 1 << SUB_BITS;
+	static const int NUM_BUCKETS = (64 - SUB_BITS + 1) * SUB_NUM;
+
+	std::atomic<uint32_t> m_Buckets[NUM_BUCKETS];
+	std::atomic<uint64_t> m_Count;
+	std::atomic<uint64_t> m_Total;
+	std::atomic<uint64_t> m_Max;
+
+public:
+	CHistogram();
+	virtual ~CHistogram();
+
+public:
+	void Reset();
+	uint64_t GetCount() const;
+	uint64_t GetMax() const;
+	uint64_t GetMean() const;
+	uint64_t GetPercentile(const double percent) const;
+
+	/** v を１回数える */
+	void Record(const uint64_t v)
+	{
+		const int idx = bucketIndex(v);
+		m_Buckets[idx].store(m_Buckets[idx].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		m_Count.store(m_Count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		m_Total.store(m_Total.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+		if( m_Max.load(std::memory_order_relaxed) < v )
+			m_Max.store(v, std::memory_order_relaxed);
+		return;
+	}
+
+private:
+	static int bucketIndex(const uint64_t v)
+	{
+		if( v < SUB_NUM )
+			return static_cast<int>(v);
+		const int e = msb(v);
+		const int sub = static_cast<int>(v >> (e - SUB_BITS)) & (SUB_NUM - 1);
+		return (e - SUB_BITS + 1) * SUB_NUM + sub;
+	}
+	static uint64_t bucketLowest(const int idx);
+	static int msb(const uint64_t v)
+	{
+#ifdef _WIN32
+		int e = 0;
+		for( uint64_t t = v; 1 < t; t >>= 1 )
+			++e;
+		return e;
+#else
+		return 63 - __builtin_clzll(v);
+#endif
+	}
+};
@@ -0,0 +1,136 @@
+﻿#include "stdafx.h"
+#include "CRealtime.h"
+#ifdef __linux
+#include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <alloca.h>
+#include <time.h>
+#endif
+
+#ifdef __linux
+static int64_t getNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+static void errorReason(const char *pWhat, const int err, const char *pHint, std::string *pReason)
+{
+	*pReason = std::string(pWhat) + ": " + strerror(err);
+	if( err == EPERM && pHint != nullptr )
+		*pReason += std::string(" (") + pHint + ")";
+	return;
+}
+#endif
+
+/** 今と今後確保するメモリをすべて物理メモリにロックする
+ */
+bool CRealtime::LockMemory(std::string *pReason)
+{
+#ifdef __linux
+	if( ::mlockall(MCL_CURRENT | MCL_FUTURE) != 0 ){
+		const int err = errno;
+		errorReason("mlockall", err, "needs CAP_IPC_LOCK or a larger RLIMIT_MEMLOCK", pReason);
+		if( err == ENOMEM )
+			*pReason += " (RLIMIT_MEMLOCK is too small)";
+		return false;
+	}
+	return true;
+#else
+	*pReason = "mlockall: not supported on this platform";
+	return false;
+#endif
+}
+
+/** 呼び出したスレッドを SCHED_FIFO の priority にする
+ */
+bool CRealtime::SetThreadPriority(const int priority, std::string *pReason)
+{
+#ifdef __linux
+	const int minp = ::sched_get_priority_min(SCHED_FIFO);
+	const int maxp = ::sched_get_priority_max(SCHED_FIFO);
+	struct sched_param param;
+	memset(&param, 0, sizeof(param));
+	param.sched_priority = (priority < minp) ? minp : ((maxp < priority) ? maxp : priority);
+	const int err = ::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &param);
+	if( err != 0 ){
+		errorReason("SCHED_FIFO", err, "needs CAP_SYS_NICE or RLIMIT_RTPRIO", pReason);
+		return false;
+	}
+	return true;
+#else
+	*pReason = "SCHED_FIFO: not supported on this platform";
+	return false;
+#endif
+}
+
+/** 呼び出したスレッドを cpu 番のコアに固定する
+ */
+bool CRealtime::SetThreadAffinity(const int cpu, std::string *pReason)
+{
+#ifdef __linux
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	const int err = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+	if( err != 0 ){
+		errorReason("CPU affinity", err, nullptr, pReason);
+		return false;
+	}
+	return true;
+#else
+	*pReason = "CPU affinity: not supported on this platform";
+	return false;
+#endif
+}
+
+/** スタックを size バイト先まで触っておき、演奏中にスタックのページフォルトが起きないようにする
+ */
+void CRealtime::PrefaultStack(const size_t size)
+{
+#ifdef __linux
+	volatile uint8_t *p = static_cast<volatile uint8_t*>(alloca(size));
+	for( size_t t = 0; t < size; t += 4096 )
+		p[t] = 0;
+#endif
+	return;
+}
+
+/** periodNs 周期で絶対時刻まで眠ることを sec 秒間繰り返し、起床の遅れを測る
+ * 呼び出したスレッドのスケジューリング設定のままで測るので、SetThreadPriority() の後で呼べば演奏時と同じ条件になる。
+ */
+bool CRealtime::MeasureLatency(const int sec, const int64_t periodNs, LATENCY *pResult)
+{
+	memset(pResult, 0, sizeof(*pResult));
+#ifdef __linux
+	const uint32_t num = static_cast<uint32_t>(static_cast<int64_t>(sec) * 1000000000LL / periodNs);
+	int64_t total = 0;
+	int64_t next = getNs();
+	for( uint32_t t = 0; t < num; ++t ){
+		next += periodNs;
+		struct timespec ts;
+		ts.tv_sec = static_cast<time_t>(next / 1000000000LL);
+		ts.tv_nsec = static_cast<long>(next % 1000000000LL);
+		while( ::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR )
+			;
+		const int64_t late = getNs() - next;
+		if( t == 0 || late < pResult->MinNs )
+			pResult->MinNs = late;
+		if( pResult->MaxNs < late )
+			pResult->MaxNs = late;
+		if( 100*1000 <= late )
+			++pResult->Over100us;
+		if( 1000*1000 <= late )
+			++pResult->Over1ms;
+		total += late;
+		++pResult->Samples;
+	}
+	if( pResult->Samples != 0 )
+		pResult->AvgNs = total / pResult->Samples;
+	return pResult->Samples != 0;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "stdafx.h"
+
+/** リアルタイム実行の設定（Linux のみ）
+ * スレッドを SCHED_FIFO にして指定コアに固定し、メモリをロックしてページフォルトを起こさないようにする。
+ * 権限が無いなどで設定できなかったときは、理由を返して通常のスケジューリングのまま続ける。
+ */
+class CRealtime
+{
+public:
+	/** 起床の遅れの測定結果 */
+	struct LATENCY
+	{
+		uint32_t	Samples;
+		int64_t		MinNs;
+		int64_t		MaxNs;
+		int64_t		AvgNs;
+		uint32_t	Over100us;		// 100us 以上遅れた回数
+		uint32_t	Over1ms;		// 1ms 以上遅れた回数
+	};
+
+public:
+	static bool LockMemory(std::string *pReason);
+	static bool SetThreadPriority(const int priority, std::string *pReason);
+	static bool SetThreadAffinity(const int cpu, std::string *pReason);
+	static void PrefaultStack(const size_t size);
+	static bool MeasureLatency(const int sec, const int64_t periodNs, LATENCY *pResult);
+};
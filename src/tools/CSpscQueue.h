@@ -0,0 +1,49 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+
+/** ロックフリーのリングバッファ（書き込み側１スレッド、読み出し側１スレッド専用）
+ * @param T 要素の型
+ * @param N 要素数（２のべき乗であること）
+ */
+template<typename T, size_t N>
+class CSpscQueue
+{
+	static_assert((N & (N-1)) == 0, "CSpscQueue: N must be a power of 2");
+private:
+	T m_Items[N];
+	std::atomic<size_t> m_Head;		// 次に読み出す位置（読み出し側だけが更新する）
+	std::atomic<size_t> m_Tail;		// 次に書き込む位置（書き込み側だけが更新する）
+
+public:
+	CSpscQueue() : m_Head(0), m_Tail(0) { return; }
+
+public:
+	/** 満杯なら false を返す */
+	bool Push(const T &v)
+	{
+		const size_t tail = m_Tail.load(std::memory_order_relaxed);
+		if( tail - m_Head.load(std::memory_order_acquire) == N )
+			return false;
+		m_Items[tail & (N-1)] = v;
+		m_Tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** 空なら false を返す */
+	bool Pop(T *pV)
+	{
+		const size_t head = m_Head.load(std::memory_order_relaxed);
+		if( head == m_Tail.load(std::memory_order_acquire) )
+			return false;
+		*pV = m_Items[head & (N-1)];
+		m_Head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** 読み出し側から見た、たまっている要素数 */
+	size_t GetCount() const
+	{
+		return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_relaxed);
+	}
+};
@@ -249,6 +249,53 @@ uint64_t t_GetFileSize(const tstring &targetPath)
 #endif /* __linux */
 }
 
+/** "秒" または "分:秒" 形式の時間を秒に変換する（秒は小数も可）
+ */
+bool t_ParseTime(const std::string &str, double *pSec)
+{
+	double sec = 0;
+	size_t pos = 0;
+	for(;;){
+		char *pEnd = nullptr;
+		const double v = strtod(str.c_str() + pos, &pEnd);
+		const size_t end = static_cast<size_t>(pEnd - str.c_str());
+		if( end == pos || v < 0 )
+			return false;
+		sec = sec * 60 + v;
+		if( end == str.size() )
+			break;
+		if( str[end] != ':' )
+			return false;
+		pos = end + 1;
+	}
+	*pSec = sec;
+	return true;
+}
+
+/** ファイルの最終更新時刻（取得できなければ 0）
+ */
+int64_t t_GetFileMTime(const tstring &targetPath)
+{
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA fad;
+	if( !GetFileAttributesEx(targetPath.c_str(), GetFileExInfoStandard, &fad) )
+		return 0;
+	return static_cast<int64_t>(fad.ftLastWriteTime.dwHighDateTime) << 32 |
+		static_cast<int64_t>(fad.ftLastWriteTime.dwLowDateTime);
+#endif /* _WIN32 */
+
+#ifdef __linux
+	std::string fpath;
+	t_ToNarrow(targetPath, &fpath);
+
+	struct stat fileInfo;
+	if( stat(fpath.c_str(), &fileInfo) != 0 )
+		return 0;
+
+	return static_cast<int64_t>(fileInfo.st_mtim.tv_sec) * 1000000000 + fileInfo.st_mtim.tv_nsec;
+#endif /* __linux */
+}
+
 bool t_ReadFile(const tstring &targetPath, std::vector<uint8_t> **pp)
 {
 	assert( !targetPath.empty() );
@@ -274,3 +321,57 @@ bool t_ReadFile(const tstring &targetPath, std::vector<uint8_t> **pp)
 
 	return true;
 }
+
+bool t_WriteFile(const tstring &targetPath, const std::vector<uint8_t> &data)
+{
+	assert( !targetPath.empty() );
+#ifdef __linux
+	std::string fpath;
+	t_ToNarrow(targetPath, &fpath);
+	FILE *pFile = ::fopen(fpath.c_str(), "wb");
+#else
+	FILE *pFile = ::_tfsopen(targetPath.c_str(), _T("wb"), _SH_DENYWR );
+#endif
+	if( pFile == nullptr )
+		return false;
+
+	bool bRet = (data.empty() || fwrite(data.data(), data.size(), 1, pFile) == 1);
+	bRet = (fclose(pFile) == 0) && bRet;
+	return bRet;
+}
+
+/** ディレクトリか
+ */
+bool t_IsDirectory(const tstring &path)
+{
+#ifdef __linux
+	std::string fpath;
+	t_ToNarrow(path, &fpath);
+	struct stat fileInfo;
+	if( stat(fpath.c_str(), &fileInfo) != 0 )
+		return false;
+	return S_ISDIR(fileInfo.st_mode);
+#endif
+#ifdef _WIN32
+	DWORD attr = ::GetFileAttributes(path.c_str());
+	return (attr != INVALID_FILE_ATTRIBUTES) && ((attr & FILE_ATTRIBUTE_DIRECTORY) != 0);
+#endif
+}
+
+/** 拡張子が一致するか（大文字小文字は区別しない）
+ */
+bool t_HasExtension(const tstring &path, const TCHAR *pExt)
+{
+	const tstring ext(pExt);
+	if( path.size() < ext.size() )
+		return false;
+	const size_t top = path.size() - ext.size();
+	for( size_t t = 0; t < ext.size(); ++t ){
+		TCHAR ch = path[top + t];
+		if( _T('A') <= ch && ch <= _T('Z') )
+			ch = ch - _T('A') + _T('a');
+		if( ch != ext[t] )
+			return false;
+	}
+	return true;
+}
@@ -0,0 +1,334 @@
+// hsztrace - hopstepz --trace で書き出した実行記録を読んで、逆アセンブルして表示する
+//
+//  USAGE: hsztrace [-n count] trace.bin
+//
+#include "stdafx.h"
+#include "CZ80Trace.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+static const char *R8[] = { "B", "C", "D", "E", "H", "L", "(HL)", "A" };
+static const char *RP[] = { "BC", "DE", "HL", "SP" };
+static const char *RP2[] = { "BC", "DE", "HL", "AF" };
+static const char *CC[] = { "NZ", "Z", "NC", "C", "PO", "PE", "P", "M" };
+static const char *ALU[] = { "ADD A,", "ADC A,", "SUB ", "SBC A,", "AND ", "XOR ", "OR ", "CP " };
+static const char *ROT[] = { "RLC", "RRC", "RL", "RR", "SLA", "SRA", "SLL", "SRL" };
+static const char *IM[] = { "0", "0", "1", "2", "0", "0", "1", "2" };
+static const char *BLI[4][4] = {
+	{ "LDI", "CPI", "INI", "OUTI" },
+	{ "LDD", "CPD", "IND", "OUTD" },
+	{ "LDIR", "CPIR", "INIR", "OTIR" },
+	{ "LDDR", "CPDR", "INDR", "OTDR" },
+};
+
+static std::string format(const char *pFmt, ...)
+{
+	char buff[64];
+	va_list args;
+	va_start(args, pFmt);
+	vsnprintf(buff, sizeof(buff), pFmt, args);
+	va_end(args);
+	return buff;
+}
+
+/** １命令を逆アセンブルする
+ * Code[] は最長の命令（４バイト）まで入っている。
+ */
+class CDisasm
+{
+private:
+	const uint8_t	*m_pCode;
+	uint16_t		m_PC;
+	int				m_Pos;		// 次に読むバイトの位置
+	int				m_Index;	// 0=HL, 1=IX, 2=IY
+	bool			m_bMem;		// (HL) を使う命令（IX/IY のときはディスプレースメントがある）
+
+public:
+	CDisasm(const uint8_t *pCode, const uint16_t pc) :
+		m_pCode(pCode), m_PC(pc), m_Pos(0), m_Index(0), m_bMem(false) { return; }
+
+	std::string Decode(int *pLen)
+	{
+		std::string s;
+		const uint8_t op = m_pCode[m_Pos++];
+		if( op == 0xDD || op == 0xFD ){
+			m_Index = (op == 0xDD) ? 1 : 2;
+			const uint8_t op2 = m_pCode[m_Pos++];
+			if( op2 == 0xCB )
+				s = decodeIndexCB();
+			else if( op2 == 0xDD || op2 == 0xED || op2 == 0xFD ){
+				// 前置は無視される
+				--m_Pos;
+				s = "NOP*";
+			}
+			else
+				s = decodeMain(op2);
+		}
+		else if( op == 0xCB )
+			s = decodeCB(m_pCode[m_Pos++]);
+		else if( op == 0xED )
+			s = decodeED(m_pCode[m_Pos++]);
+		else
+			s = decodeMain(op);
+		*pLen = m_Pos;
+		return s;
+	}
+
+private:
+	std::string hl() const
+	{
+		static const char *NAMES[] = { "HL", "IX", "IY" };
+		return NAMES[m_Index];
+	}
+	std::string mem()
+	{
+		if( m_Index == 0 )
+			return "(HL)";
+		const int8_t d = static_cast<int8_t>(m_pCode[2]);
+		return format("(%s%c%02Xh)", hl().c_str(), (d < 0) ? '-' : '+', (d < 0) ? -d : d);
+	}
+	std::string r(const int n)
+	{
+		if( n == 6 )
+			return mem();
+		if( m_Index != 0 && !m_bMem && (n == 4 || n == 5) )
+			return hl() + ((n == 4) ? "H" : "L");
+		return R8[n];
+	}
+	std::string rp(const int p) const
+	{
+		return (p == 2) ? hl() : RP[p];
+	}
+	std::string rp2(const int p) const
+	{
+		return (p == 2) ? hl() : RP2[p];
+	}
+	std::string n()
+	{
+		return format("%02Xh", m_pCode[imm(1)]);
+	}
+	std::string nn()
+	{
+		const int pos = imm(2);
+		return format("%04Xh", m_pCode[pos] | (m_pCode[pos+1] << 8));
+	}
+	std::string rel()
+	{
+		const int pos = imm(1);
+		return format("%04Xh", static_cast<uint16_t>(m_PC + pos + 1 + static_cast<int8_t>(m_pCode[pos])));
+	}
+	/** 即値の位置（IX/IY の (IX+d) を使う命令では d の後ろ） */
+	int imm(const int size)
+	{
+		if( m_Index != 0 && m_bMem && m_Pos == 2 )
+			m_Pos = 3;
+		const int pos = m_Pos;
+		m_Pos += size;
+		return pos;
+	}
+
+	std::string decodeMain(const uint8_t op)
+	{
+		const int x = op >> 6, y = (op >> 3) & 7, z = op & 7, p = y >> 1, q = y & 1;
+		m_bMem =
+			(x == 0 && 4 <= z && z <= 6 && y == 6) ||
+			(x == 1 && (y == 6 || z == 6) && op != 0x76) ||
+			(x == 2 && z == 6);
+		if( m_Index != 0 && m_bMem )
+			imm(0);
+		switch(x)
+		{
+			case 0:
+				switch(z)
+				{
+					case 0:
+						if( y == 0 ) return "NOP";
+						if( y == 1 ) return "EX AF,AF'";
+						if( y == 2 ) return "DJNZ " + rel();
+						if( y == 3 ) return "JR " + rel();
+						return std::string("JR ") + CC[y-4] + "," + rel();
+					case 1:
+						return (q == 0) ? "LD " + rp(p) + "," + nn() : "ADD " + hl() + "," + rp(p);
+					case 2:
+					{
+						static const char *LD_A[] = { "(BC)", "(DE)" };
+						if( p < 2 )
+							return (q == 0) ? std::string("LD ") + LD_A[p] + ",A" : std::string("LD A,") + LD_A[p];
+						if( p == 2 )
+							return (q == 0) ? "LD (" + nn() + ")," + hl() : "LD " + hl() + ",(" + nn() + ")";
+						return (q == 0) ? "LD (" + nn() + "),A" : "LD A,(" + nn() + ")";
+					}
+					case 3:
+						return ((q == 0) ? "INC " : "DEC ") + rp(p);
+					case 4:
+						return "INC " + r(y);
+					case 5:
+						return "DEC " + r(y);
+					case 6:
+					{
+						const std::string dst = r(y);
+						return "LD " + dst + "," + n();
+					}
+					default:
+					{
+						static const char *OPS[] = { "RLCA", "RRCA", "RLA", "RRA", "DAA", "CPL", "SCF", "CCF" };
+						return OPS[y];
+					}
+				}
+			case 1:
+				if( op == 0x76 )
+					return "HALT";
+				// LD H,(IX+d) などでは H/L はそのまま
+				return "LD " + r(y) + "," + r(z);
+			case 2:
+				return ALU[y] + r(z);
+			default:
+				switch(z)
+				{
+					case 0:
+						return std::string("RET ") + CC[y];
+					case 1:
+						if( q == 0 ) return "POP " + rp2(p);
+						if( p == 0 ) return "RET";
+						if( p == 1 ) return "EXX";
+						if( p == 2 ) return "JP (" + hl() + ")";
+						return "LD SP," + hl();
+					case 2:
+						return std::string("JP ") + CC[y] + "," + nn();
+					case 3:
+						if( y == 0 ) return "JP " + nn();
+						if( y == 2 ) return "OUT (" + n() + "),A";
+						if( y == 3 ) return "IN A,(" + n() + ")";
+						if( y == 4 ) return "EX (SP)," + hl();
+						if( y == 5 ) return "EX DE,HL";
+						return (y == 6) ? "DI" : "EI";
+					case 4:
+						return std::string("CALL ") + CC[y] + "," + nn();
+					case 5:
+						return (q == 0) ? "PUSH " + rp2(p) : "CALL " + nn();
+					case 6:
+						return ALU[y] + n();
+					default:
+						return format("RST %02Xh", y * 8);
+				}
+		}
+	}
+
+	std::string decodeCB(const uint8_t op)
+	{
+		const int x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+		if( x == 0 )
+			return std::string(ROT[y]) + " " + r(z);
+		static const char *OPS[] = { "", "BIT", "RES", "SET" };
+		return format("%s %d,", OPS[x], y) + r(z);
+	}
+
+	/** DD CB d op / FD CB d op */
+	std::string decodeIndexCB()
+	{
+		m_bMem = true;
+		const uint8_t op = m_pCode[3];
+		m_Pos = 4;
+		const int x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+		std::string s;
+		if( x == 0 )
+			s = std::string(ROT[y]) + " " + mem();
+		else{
+			static const char *OPS[] = { "", "BIT", "RES", "SET" };
+			s = format("%s %d,", OPS[x], y) + mem();
+		}
+		// 結果をレジスタにも書く（BIT 以外の非公式命令）
+		if( z != 6 && x != 1 )
+			s += std::string(",") + R8[z];
+		return s;
+	}
+
+	std::string decodeED(const uint8_t op)
+	{
+		const int x = op >> 6, y = (op >> 3) & 7, z = op & 7, p = y >> 1, q = y & 1;
+		if( x == 1 ){
+			switch(z)
+			{
+				case 0:
+					return (y == 6) ? "IN (C)" : std::string("IN ") + R8[y] + ",(C)";
+				case 1:
+					return (y == 6) ? "OUT (C),0" : std::string("OUT (C),") + R8[y];
+				case 2:
+					return std::string((q == 0) ? "SBC HL," : "ADC HL,") + RP[p];
+				case 3:
+					return (q == 0) ? "LD (" + nn() + ")," + RP[p] : std::string("LD ") + RP[p] + ",(" + nn() + ")";
+				case 4:
+					return "NEG";
+				case 5:
+					return (y == 1) ? "RETI" : "RETN";
+				case 6:
+					return std::string("IM ") + IM[y];
+				default:
+				{
+					static const char *OPS[] = { "LD I,A", "LD R,A", "LD A,I", "LD A,R", "RRD", "RLD", "NOP*", "NOP*" };
+					return OPS[y];
+				}
+			}
+		}
+		if( x == 2 && z <= 3 && 4 <= y )
+			return BLI[y-4][z];
+		return format("DB EDh,%02Xh", op);
+	}
+};
+
+static void usage()
+{
+	fprintf(stderr, "USAGE: hsztrace [-n count] trace.bin\n");
+	fprintf(stderr, "       -n count : show only the last count instructions\n");
+	return;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t last = 0;
+	int argi = 1;
+	if( argi + 1 < argc && std::string(argv[argi]) == "-n" ){
+		last = static_cast<size_t>(atol(argv[argi+1]));
+		argi += 2;
+	}
+	if( argc <= argi ){
+		usage();
+		return EXIT_FAILURE;
+	}
+	FILE *fp = fopen(argv[argi], "rb");
+	if( fp == nullptr ){
+		fprintf(stderr, "Not found %s\n", argv[argi]);
+		return EXIT_FAILURE;
+	}
+	Z80TRACEHEADER h;
+	if( fread(&h, sizeof(h), 1, fp) != 1 || memcmp(h.Magic, "HSZTRACE", sizeof(h.Magic)) != 0 ||
+		h.Version != CZ80Trace::VERSION || h.RecordSize != sizeof(Z80TRACERECORD) ){
+		fprintf(stderr, "%s is not a trace file of this version\n", argv[argi]);
+		fclose(fp);
+		return EXIT_FAILURE;
+	}
+	std::vector<Z80TRACERECORD> recs(h.NumRecords);
+	const size_t num = fread(recs.data(), sizeof(Z80TRACERECORD), recs.size(), fp);
+	fclose(fp);
+	if( num != recs.size() )
+		fprintf(stderr, "truncated: %u records expected, %u read\n", h.NumRecords, static_cast<unsigned>(num));
+
+	const size_t top = (last != 0 && last < num) ? num - last : 0;
+	printf("%-10s %-12s %-4s %-11s %-20s %-4s %-4s %-4s %-4s %-4s %-4s %-4s\n",
+		"inst", "tstates", "PC", "code", "", "AF", "BC", "DE", "HL", "IX", "IY", "SP");
+	for( size_t t = top; t < num; ++t ){
+		const Z80TRACERECORD &r = recs[t];
+		int len;
+		CDisasm dis(r.Code, r.PC);
+		const std::string mnemonic = dis.Decode(&len);
+		std::string bytes;
+		for( int b = 0; b < len; ++b )
+			bytes += format("%02X", r.Code[b]);
+		printf("%10u %12llu %04X %-11s %-20s %04X %04X %04X %04X %04X %04X %04X\n",
+			r.InstNo, static_cast<unsigned long long>(r.TStates), r.PC, bytes.c_str(), mnemonic.c_str(),
+			r.AF, r.BC, r.DE, r.HL, r.IX, r.IY, r.SP);
+	}
+	return EXIT_SUCCESS;
+}